@@ -0,0 +1,121 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#include "sl/calc/fourier.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <random>
+
+namespace sl::calc::fourier {
+
+constexpr std::size_t repetitions = 7;
+
+template <typename FloatT>
+std::vector<std::complex<FloatT>> produce_signal(std::default_random_engine& re, std::size_t N) {
+    std::uniform_real_distribution<FloatT> uniform_dist(-1, 1);
+    std::vector<std::complex<FloatT>> signal(N);
+    for (auto& x : signal) {
+        x = { uniform_dist(re), uniform_dist(re) };
+    }
+    return signal;
+}
+
+template <typename F>
+double best_ms(F&& f) {
+    double best = std::numeric_limits<double>::max();
+    for (std::size_t i = 0; i != repetitions; ++i) {
+        const auto started_at = std::chrono::steady_clock::now();
+        f();
+        best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started_at).count());
+    }
+    return best;
+}
+
+template <typename FloatT>
+void benchmark_fft(std::default_random_engine& re, const char* name, std::size_t N) {
+    const auto in = produce_signal<FloatT>(re, N);
+    const std::span<const std::complex<FloatT>> in_span{ in };
+    const double forward_ms = best_ms([in_span] { return fft<direction::time_to_freq>(in_span); });
+    const double inverse_ms = best_ms([in_span] { return fft<direction::freq_to_time>(in_span); });
+    std::printf("%8zu %8s %12.3f %12.3f\n", N, name, forward_ms, inverse_ms);
+}
+
+// reused plan writing into a caller-provided buffer, so that only the butterflies are measured
+template <typename FloatT, typename AccT>
+void benchmark_fft_plan(std::default_random_engine& re, const char* name, std::size_t N) {
+    const auto in = produce_signal<FloatT>(re, N);
+    std::vector<std::complex<FloatT>> out(N);
+    const std::span<const std::complex<FloatT>> in_span{ in };
+    const std::span<std::complex<FloatT>> out_span{ out };
+    const fft_plan<direction::time_to_freq, FloatT, AccT> forward_plan{ N };
+    const fft_plan<direction::freq_to_time, FloatT, AccT> inverse_plan{ N };
+    const double forward_ms = best_ms([&] { forward_plan.transform(in_span, out_span); });
+    const double inverse_ms = best_ms([&] { inverse_plan.transform(in_span, out_span); });
+    std::printf("%8zu %8s %12.3f %12.3f\n", N, name, forward_ms, inverse_ms);
+}
+
+// real input: `rfft` against a complex plan of the same N, analytic signal against forward and inverse complex plans
+// with the negative bins masked in between
+template <typename FloatT>
+void benchmark_real_input(std::default_random_engine& re, const char* name, std::size_t N) {
+    std::uniform_real_distribution<FloatT> uniform_dist(-1, 1);
+    std::vector<FloatT> in(N);
+    for (auto& x : in) {
+        x = uniform_dist(re);
+    }
+    const std::vector<std::complex<FloatT>> in_complex(in.begin(), in.end());
+    std::vector<std::complex<FloatT>> spectrum(N);
+    std::vector<std::complex<FloatT>> out(N);
+    std::vector<std::complex<FloatT>> bins(N / 2 + 1);
+
+    const fft_plan<direction::time_to_freq, FloatT> forward_plan{ N };
+    const fft_plan<direction::freq_to_time, FloatT> inverse_plan{ N };
+    const real_fft_plan<FloatT> real_plan{ N };
+    const analytic_plan<FloatT> analytic{ N };
+
+    const double complex_ms = best_ms([&] { forward_plan.transform(in_complex, spectrum); });
+    const double real_ms = best_ms([&] { real_plan.transform(in, bins); });
+    const double masked_ms = best_ms([&] {
+        const std::vector<std::complex<FloatT>> widened(in.begin(), in.end());
+        forward_plan.transform(widened, spectrum);
+        for (std::size_t k = 1; k != N; ++k) {
+            spectrum[k] *= k < N / 2 ? FloatT{ 2 } : k == N / 2 ? FloatT{ 1 } : FloatT{ 0 };
+        }
+        inverse_plan.transform(spectrum, out);
+    });
+    const double analytic_ms = best_ms([&] { analytic.analytic_signal(in, out); });
+    std::printf("%8zu %8s %12.3f %12.3f %12.3f %12.3f\n", N, name, complex_ms, real_ms, masked_ms, analytic_ms);
+}
+
+} // namespace sl::calc::fourier
+
+int main() {
+    using namespace sl::calc::fourier;
+    std::default_random_engine re{ 42 };
+
+    std::printf("one-shot fft, best of %zu\n", repetitions);
+    std::printf("%8s %8s %12s %12s\n", "N", "type", "forward, ms", "inverse, ms");
+    for (const std::size_t N : { std::size_t{ 1 } << 16, std::size_t{ 1 } << 20 }) {
+        benchmark_fft<float>(re, "float", N);
+        benchmark_fft<double>(re, "double", N);
+    }
+
+    std::printf("fft_plan, best of %zu\n", repetitions);
+    std::printf("%8s %8s %12s %12s\n", "N", "type", "forward, ms", "inverse, ms");
+    for (const std::size_t N : { std::size_t{ 1 } << 16, std::size_t{ 1 } << 20 }) {
+        benchmark_fft_plan<float, float>(re, "float", N);
+        benchmark_fft_plan<float, double>(re, "mixed", N);
+        benchmark_fft_plan<double, double>(re, "double", N);
+    }
+
+    std::printf("real input, best of %zu\n", repetitions);
+    std::printf("%8s %8s %12s %12s %12s %12s\n", "N", "type", "fft, ms", "rfft, ms", "masked, ms", "analytic, ms");
+    for (const std::size_t N : { std::size_t{ 1 } << 12, std::size_t{ 1 } << 16, std::size_t{ 1 } << 20 }) {
+        benchmark_real_input<float>(re, "float", N);
+        benchmark_real_input<double>(re, "double", N);
+    }
+}
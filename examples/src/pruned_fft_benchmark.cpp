@@ -0,0 +1,66 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#include "sl/calc/fourier.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <random>
+
+namespace sl::calc::fourier {
+
+constexpr std::size_t N = 1 << 20;
+constexpr std::size_t repetitions = 7;
+
+std::vector<std::complex<double>> produce_signal(std::default_random_engine& re, std::size_t size) {
+    std::uniform_real_distribution<double> uniform_dist(-1, 1);
+    std::vector<std::complex<double>> signal(size);
+    for (auto& x : signal) {
+        x = { uniform_dist(re), uniform_dist(re) };
+    }
+    return signal;
+}
+
+template <typename F>
+double best_ms(F&& f) {
+    double best = std::numeric_limits<double>::max();
+    for (std::size_t i = 0; i != repetitions; ++i) {
+        const auto started_at = std::chrono::steady_clock::now();
+        f();
+        best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started_at).count());
+    }
+    return best;
+}
+
+// pruning to L (or M) out of N does log2(L) stages instead of log2(N), that ratio is what the speedup should approach
+double expected_speedup(std::size_t pruned_size) {
+    return static_cast<double>(std::countr_zero(N)) / std::max(1.0, static_cast<double>(std::countr_zero(pruned_size)));
+}
+
+} // namespace sl::calc::fourier
+
+int main() {
+    using namespace sl::calc::fourier;
+    std::default_random_engine re{ 42 };
+
+    const auto in = produce_signal(re, N);
+    std::vector<std::complex<double>> out(N);
+    const fft_plan<direction::time_to_freq, double> full_plan{ N };
+    const pruned_fft_plan<direction::time_to_freq, double> pruned_plan{ N };
+    const double full_ms = best_ms([&] { full_plan.transform(in, out); });
+
+    std::printf("N = %zu, fft_plan %.3f ms, best of %zu\n", N, full_ms, repetitions);
+    std::printf("%8s %14s %10s %14s %10s %10s\n", "L or M", "input, ms", "speedup", "output, ms", "speedup", "expected");
+    for (const std::size_t pruned_size : { std::size_t{ 64 }, std::size_t{ 1024 }, N / 64, N / 4 }) {
+        const std::span<const std::complex<double>> head{ in.data(), pruned_size };
+        const std::span<std::complex<double>> out_head{ out.data(), pruned_size };
+        const double input_ms = best_ms([&] { pruned_plan.transform_input_pruned(head, out); });
+        const double output_ms = best_ms([&] { pruned_plan.transform_output_pruned(in, out_head); });
+        std::printf("%8zu %14.3f %9.1fx %14.3f %9.1fx %9.1fx\n", pruned_size, input_ms, full_ms / input_ms, output_ms,
+                    full_ms / output_ms, expected_speedup(pruned_size));
+    }
+}
@@ -0,0 +1,74 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#include "sl/calc/fourier.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+namespace sl::calc::fourier {
+
+constexpr std::size_t N = 1 << 20;
+constexpr std::size_t repetitions = 5;
+
+// k tones of distinct random frequencies and random phases, plus white noise
+std::vector<std::complex<double>> produce_signal(std::default_random_engine& re, std::size_t k, double noise) {
+    std::uniform_int_distribution<std::size_t> freq_dist(0, N - 1);
+    std::uniform_real_distribution<double> phase_dist(0.0, 2 * std::numbers::pi);
+    std::vector<std::complex<double>> spectrum(N);
+    for (std::size_t i = 0; i != k;) {
+        auto& coefficient = spectrum[freq_dist(re)];
+        if (coefficient == std::complex<double>{}) {
+            coefficient = std::polar(static_cast<double>(N), phase_dist(re));
+            ++i;
+        }
+    }
+    auto signal = fft<direction::freq_to_time>(std::span<const std::complex<double>>{ spectrum });
+
+    std::normal_distribution<double> noise_dist(0.0, noise);
+    for (auto& x : signal) {
+        x += std::complex{ noise_dist(re), noise_dist(re) };
+    }
+    return signal;
+}
+
+template <typename F>
+double median_ms(F&& f) {
+    std::vector<double> ms;
+    for (std::size_t i = 0; i != repetitions; ++i) {
+        const auto started_at = std::chrono::steady_clock::now();
+        f();
+        ms.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started_at).count());
+    }
+    std::nth_element(ms.begin(), ms.begin() + repetitions / 2, ms.end());
+    return ms[repetitions / 2];
+}
+
+} // namespace sl::calc::fourier
+
+int main() {
+    using namespace sl::calc::fourier;
+    std::default_random_engine re{ 42 };
+
+    std::printf("N = %zu, dense fft as baseline\n", N);
+    std::printf("%8s %8s %12s %12s %10s\n", "k", "noise", "fft, ms", "sparse, ms", "speedup");
+    for (const double noise : { 0.0, 0.01 }) {
+        for (const std::size_t k : { 1u, 4u, 16u, 64u, 256u, 1024u }) {
+            const auto in = produce_signal(re, k, noise);
+            const std::span<const std::complex<double>> in_span{ in };
+            const sparse_fft_options<double> options{ .tolerance = noise == 0.0 ? 1e-9 : 1e-3 };
+
+            sparse_fft_result<double> result;
+            const double dense_ms = median_ms([in_span] { return fft<direction::time_to_freq>(in_span); });
+            const double sparse_ms = median_ms([in_span, k, &options, &result] {
+                result = sparse_fft<direction::time_to_freq>(in_span, k, options);
+            });
+            std::printf("%8zu %8.2f %12.3f %12.3f %9.1fx%s%s\n", k, noise, dense_ms, sparse_ms, dense_ms / sparse_ms,
+                        result.coefficients.size() == k ? "" : " (fewer coefficients found)",
+                        result.dense_fallback ? " (dense fallback)" : "");
+        }
+    }
+}
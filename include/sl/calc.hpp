@@ -6,3 +6,5 @@
 
 #include "sl/calc/bits.hpp"
 #include "sl/calc/fourier.hpp"
+
+// "sl/calc/npy.hpp" is opt-in: it needs POSIX and a little-endian host
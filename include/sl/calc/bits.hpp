@@ -82,6 +82,9 @@ constexpr IntT bitswap(IntT n) {
 template <typename IntT>
     requires detail::bit_ops_supported<IntT>
 constexpr IntT bitswap(IntT n, std::size_t bit_width) {
+    if (bit_width == 0) {
+        return n;
+    }
     constexpr auto cast = [](auto a_n) { return static_cast<IntT>(a_n); };
     const IntT unchanged = cast(cast(n >> bit_width) << bit_width);
     const std::size_t shift = detail::sizeof_bits<IntT>() - bit_width;
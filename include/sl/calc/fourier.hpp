@@ -4,12 +4,30 @@
 
 #pragma once
 
+#include "fourier/analytic.hpp"
 #include "fourier/discrete.hpp"
 #include "fourier/fast.hpp"
+#include "fourier/fixed.hpp"
+#include "fourier/pruned.hpp"
+#include "fourier/real.hpp"
+#include "fourier/sparse.hpp"
+#include "fourier/spectral.hpp"
+#include "fourier/stream.hpp"
+#include "fourier/zoom.hpp"
 
 namespace sl::calc {
 
+using fourier::analytic_signal;
 using fourier::dft;
+using fourier::envelope;
 using fourier::fft;
+using fourier::fft_input_pruned;
+using fourier::fft_output_pruned;
+using fourier::fixed_fft;
+using fourier::hilbert;
+using fourier::rfft;
+using fourier::sparse_fft;
+using fourier::welch;
+using fourier::zoom_fft;
 
 } // namespace sl::calc
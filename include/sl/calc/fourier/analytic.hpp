@@ -0,0 +1,143 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#pragma once
+
+#include <bit>
+#include <complex>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "sl/calc/bits.hpp"
+#include "sl/calc/fourier/detail.hpp"
+#include "sl/calc/fourier/fast.hpp"
+#include "sl/calc/fourier/real.hpp"
+
+#include <sl/meta/assert.hpp>
+
+namespace sl::calc::fourier {
+
+// Analytic signal $$ a_n = x_n + i \mathcal{H}(x)_n $$ of N real samples, its spectrum is X_k doubled for 0 < k < N/2,
+// kept for k = 0 and k = N/2, zero otherwise.
+// Forward is a `real_fft_plan`-style transform of size N/2. Only the first N/2 + 1 bins survive, so the inverse is
+// input-pruned into two transforms of size N/2, for even and odd n.
+// Bins are unpacked once, in natural order, masked, scaled by 1/N and twiddled by $$ \omega_N^{-k} $$ for the odd samples,
+// straight into the bit-reversed order of both inverse transforms. The Nyquist bin is added and the result is written
+// into the caller's buffer in the last-stage stores.
+template <typename FloatT>
+    requires std::is_floating_point_v<FloatT>
+class analytic_plan {
+public:
+    explicit analytic_plan(std::size_t N) : N_{ N }, twiddles_{ detail::make_twiddles<direction::time_to_freq, FloatT>(N) } {
+        ASSERT(std::has_single_bit(N) && N >= 2, "only accepting powers of 2 from 2");
+    }
+
+    [[nodiscard]] std::size_t size() const { return N_; }
+
+    void analytic_signal(std::span<const FloatT> in, std::span<std::complex<FloatT>> out) const {
+        ASSERT(out.size() == N_, "plan is made for a different size");
+        for_each_sample(in, [out](std::size_t n, const std::complex<FloatT>& a) { out[n] = a; });
+    }
+
+    // imaginary part of the analytic signal
+    void hilbert(std::span<const FloatT> in, std::span<FloatT> out) const {
+        ASSERT(out.size() == N_, "plan is made for a different size");
+        for_each_sample(in, [out](std::size_t n, const std::complex<FloatT>& a) { out[n] = a.imag(); });
+    }
+
+    // magnitude of the analytic signal
+    void envelope(std::span<const FloatT> in, std::span<FloatT> out) const {
+        ASSERT(out.size() == N_, "plan is made for a different size");
+        for_each_sample(in, [out](std::size_t n, const std::complex<FloatT>& a) { out[n] = std::abs(a); });
+    }
+
+private:
+    template <typename StoreF>
+    void for_each_sample(std::span<const FloatT> in, StoreF&& store) const {
+        ASSERT(in.size() == N_, "plan is made for a different size");
+        const std::size_t M = N_ / 2;
+        const std::span<const std::complex<FloatT>> twiddles = twiddles_;
+
+        std::vector<std::complex<FloatT>> packed(M);
+        detail::real_fft_packed(in, std::span{ packed }, twiddles);
+
+        // $$ A_k = \overline{X_k} \frac{2}{N} $$ for 0 < k < N/2, $$ \frac{\overline{X_0}}{N} $$ for k = 0,
+        // conjugated, so that the inverse transforms are done forward and share the twiddles,
+        // stored bit-reversed as they are unpacked, which is the permutation of both half-size transforms:
+        // $$ a_{2 s + r} = \sum_{k < N/2} (A_k \omega_N^{-k r}) \omega_{N/2}^{-k s} + \frac{X_{N/2}}{N} (-1)^r $$
+        const FloatT scale = FloatT{ 1 } / static_cast<FloatT>(N_);
+        const auto last_twiddles = detail::stage_twiddles(twiddles, N_);
+        const auto half_M_bit_width = static_cast<std::size_t>(std::bit_width(M >> 1));
+        std::vector<std::complex<FloatT>> even_scratch(M);
+        std::vector<std::complex<FloatT>> odd_scratch(M);
+        FloatT nyquist = 0;
+        detail::real_fft_unpack(
+            std::span<const std::complex<FloatT>>{ packed },
+            last_twiddles,
+            [&even_scratch, &odd_scratch, &nyquist, last_twiddles, half_M_bit_width, M, scale](
+                std::size_t k, const std::complex<FloatT>& x
+            ) {
+                if (k == M) {
+                    nyquist = x.real() * scale;
+                    return;
+                }
+                const std::complex<FloatT> a = std::conj(x) * (k == 0 ? scale : 2 * scale);
+                const std::size_t k_bitswapped = bitswap(k, half_M_bit_width);
+                even_scratch[k_bitswapped] = a;
+                odd_scratch[k_bitswapped] = detail::twiddle_multiply(last_twiddles[k], a);
+            }
+        );
+
+        // $$ \frac{X_{N/2}}{N} e^{i \pi n} $$ is added in the stores
+        for (std::size_t r = 0; r != 2; ++r) {
+            const FloatT nyquist_r = r == 0 ? nyquist : -nyquist;
+            detail::fft_butterflies(
+                std::span{ r == 0 ? even_scratch : odd_scratch },
+                twiddles,
+                [&store, r, nyquist_r](std::size_t s, const std::complex<FloatT>& x) {
+                    store(2 * s + r, std::complex<FloatT>{ x.real() + nyquist_r, -x.imag() });
+                }
+            );
+        }
+    }
+
+private:
+    std::size_t N_;
+    std::vector<std::complex<FloatT>> twiddles_;
+};
+
+template <typename FloatT, std::size_t extent_>
+    requires std::is_floating_point_v<FloatT> && detail::extent_is_power_of_2<extent_>
+std::vector<std::complex<FloatT>> analytic_signal(std::span<const FloatT, extent_> in) {
+    std::vector<std::complex<FloatT>> out(in.size());
+    analytic_plan<FloatT>{ in.size() }.analytic_signal(in, std::span{ out });
+    return out;
+}
+
+template <typename FloatT, std::size_t extent_>
+    requires std::is_floating_point_v<FloatT> && detail::extent_is_power_of_2<extent_>
+std::vector<FloatT> hilbert(std::span<const FloatT, extent_> in) {
+    std::vector<FloatT> out(in.size());
+    analytic_plan<FloatT>{ in.size() }.hilbert(in, std::span{ out });
+    return out;
+}
+
+// writes into a caller-provided buffer of the same size
+template <typename FloatT, std::size_t extent_in_, std::size_t extent_out_>
+    requires std::is_floating_point_v<FloatT> && detail::extent_is_power_of_2<extent_in_>
+             && detail::extent_is_power_of_2<extent_out_>
+void envelope(std::span<const FloatT, extent_in_> in, std::span<FloatT, extent_out_> out) {
+    analytic_plan<FloatT>{ in.size() }.envelope(in, out);
+}
+
+template <typename FloatT, std::size_t extent_>
+    requires std::is_floating_point_v<FloatT> && detail::extent_is_power_of_2<extent_>
+std::vector<FloatT> envelope(std::span<const FloatT, extent_> in) {
+    std::vector<FloatT> out(in.size());
+    envelope(in, std::span{ out });
+    return out;
+}
+
+} // namespace sl::calc::fourier
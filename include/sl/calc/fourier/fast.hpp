@@ -5,7 +5,10 @@
 #pragma once
 
 #include <complex>
+#include <functional>
+#include <span>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "sl/calc/bits.hpp"
@@ -44,50 +47,156 @@ std::vector<std::complex<FloatT>>
     return out;
 }
 
-// decimation-in-time (DIT)
-template <direction direction_, typename FloatT, std::size_t extent_>
-std::vector<std::complex<FloatT>> fft_impl(std::span<const std::complex<FloatT>, extent_> in) {
-    const std::size_t N = in.size();
+// step 1: bit-reversal permutation
+// `load(n)` produces the n-th input sample, so that per-sample preprocessing (e.g. windowing) costs no extra pass
+template <typename FloatT, typename LoadF>
+void fft_permute(std::span<std::complex<FloatT>> out, LoadF&& load) {
+    const std::size_t N = out.size();
     const auto half_N_bit_width = static_cast<std::size_t>(std::bit_width(N >> 1));
 
-    std::vector<std::complex<FloatT>> out(N);
+    for (std::size_t k = 0; k < N; ++k) {
+        const std::size_t k_bitswapped = bitswap(k, half_N_bit_width);
+        out[k] = load(k_bitswapped);
+    }
+}
+
+// same permutation done in place, by swapping pairs
+template <typename FloatT>
+void fft_permute_in_place(std::span<std::complex<FloatT>> data) {
+    const std::size_t N = data.size();
+    const auto half_N_bit_width = static_cast<std::size_t>(std::bit_width(N >> 1));
 
-    // step 1: bit-reversal permutation
     for (std::size_t k = 0; k < N; ++k) {
         const std::size_t k_bitswapped = bitswap(k, half_N_bit_width);
-        out[k] = in[k_bitswapped];
-    }
-
-    // step 2: iterative computation
-    for (std::size_t stride = 1; stride <= N; stride <<= 1) {
-        // compute the fundamental frequency twiddle factor for this stride
-        // $$ \omega = e^{-i 2 \pi \frac{1}{stride}} $$
-        const auto fundamental_freq = detail::polar(detail::theta<direction_, FloatT>(1, stride));
-
-        // perform FFT for each segment of the current stride
-        for (size_t offset = 0; offset < N; offset += stride) {
-            // initialize twiddle factor
-            // $$ \omega^0 = 1 $$
-            std::complex<FloatT> twiddle_factor{ 1 };
-
-            for (size_t k = 0; k != stride / 2; ++k) {
-                const auto even /*           */ = /*            */ out[offset + k];
-                const auto twiddle_factor_x_odd = twiddle_factor * out[offset + k + stride / 2];
-
-                // apply the butterfly operation
-                out[offset + k] /*        */ = even + twiddle_factor_x_odd;
-                out[offset + k + stride / 2] = even - twiddle_factor_x_odd;
-
-                // update the twiddle factor for the next butterfly operation
-                // $$ \omega^1 = e^{-i 2 \pi \frac{1}{stride}} $$
-                // $$ \omega^2 = e^{-i 2 \pi \frac{2}{stride}} $$
-                // ...
-                twiddle_factor *= fundamental_freq;
+        if (k < k_bitswapped) {
+            std::swap(data[k], data[k_bitswapped]);
+        }
+    }
+}
+
+// twiddles are generated in at least double precision, whatever precision they are stored in
+template <typename TwiddleT>
+using twiddle_generation_t = std::common_type_t<TwiddleT, double>;
+
+// $$ \omega_{stride}^k = e^{-i 2 \pi \frac{k}{stride}} $$ for k < stride/2, for every stride = 2, 4, ..., N,
+// stored stage after stage, stride/2 - 1 is where a stage starts, so that butterflies read them contiguously,
+// which also makes a table for any N' >= N start with the one for N
+// recurrence keeps generation cheap, re-seeding it every few steps keeps its error from accumulating
+template <direction direction_, typename TwiddleT>
+    requires std::is_floating_point_v<TwiddleT>
+std::vector<std::complex<TwiddleT>> make_twiddles(std::size_t N) {
+    using generation_t = twiddle_generation_t<TwiddleT>;
+    constexpr std::size_t reseed_period = 32;
+
+    std::vector<std::complex<TwiddleT>> twiddles(N > 1 ? N - 1 : 0);
+    for (std::size_t stride = 2; stride <= N; stride <<= 1) {
+        const auto fundamental_freq = detail::polar(detail::theta<direction_, generation_t>(1, stride));
+        std::complex<generation_t> twiddle_factor;
+        for (std::size_t k = 0; k != stride / 2; ++k) {
+            if (k % reseed_period == 0) {
+                twiddle_factor = detail::polar(detail::theta<direction_, generation_t>(k, stride));
             }
+            twiddles[stride / 2 - 1 + k] = static_cast<std::complex<TwiddleT>>(twiddle_factor);
+            twiddle_factor *= fundamental_freq;
         }
     }
+    return twiddles;
+}
 
-    return out;
+// $$ \omega_{stride}^k $$ for k < stride/2 out of a table made by `make_twiddles`, empty for stride 1
+template <typename TwiddleT>
+std::span<const std::complex<TwiddleT>> stage_twiddles(std::span<const std::complex<TwiddleT>> twiddles, std::size_t stride) {
+    if (stride < 2) {
+        return {};
+    }
+    return twiddles.subspan(stride / 2 - 1, stride / 2);
+}
+
+// $$ \omega x $$ spelled out in the precision of the twiddles,
+// std::complex multiplication checks its result for nan to recover infinities, which keeps the loops from vectorizing
+template <typename TwiddleT, typename FloatT>
+std::complex<TwiddleT> twiddle_multiply(const std::complex<TwiddleT>& w, const std::complex<FloatT>& x) {
+    const auto x_real = static_cast<TwiddleT>(x.real());
+    const auto x_imag = static_cast<TwiddleT>(x.imag());
+    return { w.real() * x_real - w.imag() * x_imag, w.real() * x_imag + w.imag() * x_real };
+}
+
+// single in-place butterfly stage over segments of size `stride`, butterflies are computed in precision of the twiddles
+// works on raw pointers, the same loop indexing through std::span measured several times slower
+template <typename FloatT, typename TwiddleT>
+void fft_stage(std::complex<FloatT>* data, std::size_t N, const std::complex<TwiddleT>* twiddles, std::size_t stride) {
+    const std::size_t half = stride / 2;
+    // perform FFT for each segment of the current stride
+    for (std::size_t offset = 0; offset < N; offset += stride) {
+        std::complex<FloatT>* const even_data = data + offset;
+        std::complex<FloatT>* const odd_data = even_data + half;
+        for (std::size_t k = 0; k != half; ++k) {
+            const std::complex<TwiddleT> even(even_data[k]);
+            const auto twiddle_factor_x_odd = twiddle_multiply(twiddles[k], odd_data[k]);
+
+            // apply the butterfly operation
+            even_data[k] = static_cast<std::complex<FloatT>>(even + twiddle_factor_x_odd);
+            odd_data[k] = static_cast<std::complex<FloatT>>(even - twiddle_factor_x_odd);
+        }
+    }
+}
+
+// step 2: iterative computation
+// all stages but the last one are done in-place, the last one hands X_k to `store(k, X_k)`,
+// which lets callers fuse normalization or post-processing (e.g. |X_k|^2) into it
+// `twiddles` are made by `make_twiddles` for any N' >= N
+template <typename FloatT, typename TwiddleT, typename StoreF>
+void fft_butterflies(std::span<std::complex<FloatT>> out, std::span<const std::complex<TwiddleT>> twiddles, StoreF&& store) {
+    const std::size_t N = out.size();
+    if (N == 1) {
+        store(0, out[0]);
+        return;
+    }
+    ASSERT(twiddles.size() >= N - 1, "twiddles are made for a smaller size");
+
+    std::complex<FloatT>* const data = out.data();
+    for (std::size_t stride = 2; stride < N; stride <<= 1) {
+        fft_stage(data, N, stage_twiddles(twiddles, stride).data(), stride);
+    }
+
+    const std::size_t half_N = N / 2;
+    const std::complex<TwiddleT>* const last_twiddles = stage_twiddles(twiddles, N).data();
+    for (std::size_t k = 0; k != half_N; ++k) {
+        const std::complex<TwiddleT> even(data[k]);
+        const auto twiddle_factor_x_odd = twiddle_multiply(last_twiddles[k], data[k + half_N]);
+        store(k /*       */, static_cast<std::complex<FloatT>>(even + twiddle_factor_x_odd));
+        store(k + half_N, static_cast<std::complex<FloatT>>(even - twiddle_factor_x_odd));
+    }
+}
+
+// decimation-in-time (DIT), `out` has to be of the same size as `in`, either the same buffer or not overlapping it
+// normalization for `direction::freq_to_time` is fused into the last stage
+template <direction direction_, typename FloatT, typename TwiddleT>
+void fft_impl(
+    std::span<const std::complex<FloatT>> in,
+    std::span<std::complex<FloatT>> out,
+    std::span<const std::complex<TwiddleT>> twiddles
+) {
+    const std::size_t N = in.size();
+
+    if (in.data() == out.data()) {
+        fft_permute_in_place(out);
+    } else {
+        ASSERT(
+            !std::less<>{}(in.data(), out.data() + N) || !std::less<>{}(out.data(), in.data() + N),
+            "input and output have to be the same buffer or not overlap"
+        );
+        fft_permute(out, [in](std::size_t n) { return in[n]; });
+    }
+
+    if constexpr (direction_ == direction::freq_to_time) {
+        const FloatT scale = FloatT{ 1 } / static_cast<FloatT>(N);
+        fft_butterflies(out, twiddles, [out, scale](std::size_t k, const std::complex<FloatT>& x) {
+            out[k] = x * scale;
+        });
+    } else {
+        fft_butterflies(out, twiddles, [out](std::size_t k, const std::complex<FloatT>& x) { out[k] = x; });
+    }
 }
 
 } // namespace detail
@@ -111,21 +220,67 @@ std::vector<std::complex<FloatT>> fft_recursive(std::span<const std::complex<Flo
     return out;
 }
 
+// Precomputed transform of a fixed size N, reusable across calls.
+// Twiddles are stored as AccT and butterflies are computed in AccT, while data stays FloatT in memory:
+// fft_plan<direction, float, double> halves the memory traffic of double at close to its accuracy.
+template <direction direction_, typename FloatT, typename AccT = FloatT>
+    requires std::is_floating_point_v<FloatT> && std::is_floating_point_v<AccT> && (sizeof(AccT) >= sizeof(FloatT))
+class fft_plan {
+public:
+    explicit fft_plan(std::size_t N) : N_{ N }, twiddles_{ detail::make_twiddles<direction_, AccT>(N) } {
+        ASSERT(std::has_single_bit(N), "only accepting powers of 2");
+    }
+
+    [[nodiscard]] std::size_t size() const { return N_; }
+    [[nodiscard]] std::span<const std::complex<AccT>> twiddles() const { return twiddles_; }
+
+    // `out` may be `in` itself, for an in-place transform
+    void transform(std::span<const std::complex<FloatT>> in, std::span<std::complex<FloatT>> out) const {
+        ASSERT(in.size() == N_ && out.size() == N_, "plan is made for a different size");
+        detail::fft_impl<direction_>(in, out, twiddles());
+    }
+
+    std::vector<std::complex<FloatT>> transform(std::span<const std::complex<FloatT>> in) const {
+        std::vector<std::complex<FloatT>> out(N_);
+        transform(in, std::span{ out });
+        return out;
+    }
+
+private:
+    std::size_t N_;
+    std::vector<std::complex<AccT>> twiddles_;
+};
+
+// twiddles are made for every call, use `fft_plan` to keep them for repeated transforms of the same size
 template <direction direction_, typename FloatT, std::size_t extent_>
     requires std::is_floating_point_v<FloatT> && detail::extent_is_power_of_2<extent_>
 std::vector<std::complex<FloatT>> fft(std::span<const std::complex<FloatT>, extent_> in) {
     const std::size_t N = in.size();
     ASSERT(std::has_single_bit(N), "only accepting powers of 2");
 
-    auto out = detail::fft_impl<direction_>(in);
+    const auto twiddles = detail::make_twiddles<direction_, FloatT>(N);
+    std::vector<std::complex<FloatT>> out(N);
+    detail::fft_impl<direction_>(
+        std::span<const std::complex<FloatT>>{ in }, std::span{ out }, std::span<const std::complex<FloatT>>{ twiddles }
+    );
+    return out;
+}
 
-    if constexpr (direction_ == direction::freq_to_time) {
-        for (auto& out_elem : out) {
-            out_elem /= static_cast<FloatT>(N);
-        }
-    }
+// same as above, but writes into a caller-provided buffer of the same size, which may be `in` itself
+template <direction direction_, typename FloatT, std::size_t extent_in_, std::size_t extent_out_>
+    requires std::is_floating_point_v<FloatT> && detail::extent_is_power_of_2<extent_in_>
+             && detail::extent_is_power_of_2<extent_out_>
+void fft(std::span<const std::complex<FloatT>, extent_in_> in, std::span<std::complex<FloatT>, extent_out_> out) {
+    const std::size_t N = in.size();
+    ASSERT(std::has_single_bit(N), "only accepting powers of 2");
+    ASSERT(out.size() == N, "output has to be of the same size as input");
 
-    return out;
+    const auto twiddles = detail::make_twiddles<direction_, FloatT>(N);
+    detail::fft_impl<direction_>(
+        std::span<const std::complex<FloatT>>{ in },
+        std::span<std::complex<FloatT>>{ out },
+        std::span<const std::complex<FloatT>>{ twiddles }
+    );
 }
 
 } // namespace sl::calc::fourier
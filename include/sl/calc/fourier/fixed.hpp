@@ -0,0 +1,319 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// the SSSE3 stage is compiled for its own target and picked at runtime, so the default build gets it too
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SL_CALC_FIXED_FFT_SSSE3 1
+#include <tmmintrin.h>
+#endif
+
+#include "sl/calc/bits.hpp"
+#include "sl/calc/fourier/detail.hpp"
+
+#include <sl/meta/assert.hpp>
+
+namespace sl::calc::fourier {
+
+// Q15 for int16_t, Q31 for int32_t: the integer represents $$ \frac{x}{2^{15}} $$ or $$ \frac{x}{2^{31}} $$
+template <typename IntT>
+concept q_format = std::is_same_v<IntT, std::int16_t> || std::is_same_v<IntT, std::int32_t>;
+
+template <typename IntT>
+    requires q_format<IntT>
+struct q_complex {
+    IntT real;
+    IntT imag;
+
+    bool operator==(const q_complex&) const = default;
+};
+
+// block floating point spectrum: $$ X_k = values_k \cdot 2^{exponent} $$, values in the same Q-format as the input
+template <typename IntT>
+    requires q_format<IntT>
+struct fixed_fft_result {
+    std::vector<q_complex<IntT>> values;
+    int exponent;
+};
+
+namespace detail {
+
+template <typename IntT>
+constexpr int q_fraction_bits = std::numeric_limits<IntT>::digits;
+
+// wide enough for a product of two samples
+template <typename IntT>
+using q_wide_t = std::conditional_t<std::is_same_v<IntT, std::int16_t>, std::int32_t, std::int64_t>;
+
+// rounding multiply-high, same as _mm_mulhrs_epi16 for Q15
+template <typename IntT>
+IntT q_mul(IntT x, IntT w) {
+    using wide_t = q_wide_t<IntT>;
+    constexpr int F = q_fraction_bits<IntT>;
+    return static_cast<IntT>((static_cast<wide_t>(x) * w + (wide_t{ 1 } << (F - 1))) >> F);
+}
+
+// rounding arithmetic shift right, same as _mm_mulhrs_epi16 by 2^(15 - shift) for Q15
+template <typename IntT>
+IntT q_shift(IntT x, int shift) {
+    using wide_t = q_wide_t<IntT>;
+    return shift == 0 ? x : static_cast<IntT>((static_cast<wide_t>(x) + (wide_t{ 1 } << (shift - 1))) >> shift);
+}
+
+// components of the data seen so far, decide the scaling of the next stage
+template <typename IntT>
+struct q_extent {
+    IntT min = std::numeric_limits<IntT>::max();
+    IntT max = std::numeric_limits<IntT>::min();
+
+    void extend(const q_complex<IntT>& x) {
+        min = std::min({ min, x.real, x.imag });
+        max = std::max({ max, x.real, x.imag });
+    }
+
+    [[nodiscard]] q_wide_t<IntT> magnitude() const {
+        return std::max(static_cast<q_wide_t<IntT>>(max), -static_cast<q_wide_t<IntT>>(min));
+    }
+
+    // components grow by at most $$ 1 + \sqrt{2} $$ in a butterfly, plus a unit of rounding from the shift and the twiddle,
+    // inputs below `headroom` can't overflow
+    [[nodiscard]] int stage_shift() const {
+        constexpr auto headroom = static_cast<q_wide_t<IntT>>(
+            static_cast<long double>(std::numeric_limits<IntT>::max() - 2) / (1 + std::numbers::sqrt2_v<long double>)
+        );
+        int shift = 0;
+        while ((magnitude() >> shift) >= headroom) {
+            ++shift;
+        }
+        return shift;
+    }
+};
+
+// twiddles of every stage stored contiguously, stage with segments of size `stride` starts at stride / 2 - 1
+// $$ \omega^k = e^{-i 2 \pi \frac{k}{stride}} $$ for k < stride / 2
+template <direction direction_, typename IntT>
+std::vector<q_complex<IntT>> make_fixed_twiddles(std::size_t N) {
+    constexpr auto scale = static_cast<long double>(q_wide_t<IntT>{ 1 } << q_fraction_bits<IntT>);
+    const auto quantize = [](long double x) {
+        const auto q = std::llround(x * scale);
+        return static_cast<IntT>(std::clamp<long long>(q, std::numeric_limits<IntT>::min(), std::numeric_limits<IntT>::max()));
+    };
+
+    std::vector<q_complex<IntT>> twiddles(N > 1 ? N - 1 : 0);
+    for (std::size_t stride = 2; stride <= N; stride <<= 1) {
+        for (std::size_t k = 0; k != stride / 2; ++k) {
+            const auto twiddle_factor = polar(theta<direction_, long double>(k, stride));
+            twiddles[stride / 2 - 1 + k] = { quantize(twiddle_factor.real()), quantize(twiddle_factor.imag()) };
+        }
+    }
+    return twiddles;
+}
+
+// $$ X_k = E_k + \omega^k O_k $$, $$ X_{k + stride/2} = E_k - \omega^k O_k $$, both inputs scaled down by 2^shift
+template <typename IntT>
+void fixed_butterfly(q_complex<IntT>& even, q_complex<IntT>& odd, q_complex<IntT> w, int shift, q_extent<IntT>& extent) {
+    const q_complex<IntT> a{ q_shift(even.real, shift), q_shift(even.imag, shift) };
+    const q_complex<IntT> b{ q_shift(odd.real, shift), q_shift(odd.imag, shift) };
+    const q_complex<IntT> t{
+        static_cast<IntT>(q_mul(b.real, w.real) - q_mul(b.imag, w.imag)),
+        static_cast<IntT>(q_mul(b.real, w.imag) + q_mul(b.imag, w.real)),
+    };
+    even = { static_cast<IntT>(a.real + t.real), static_cast<IntT>(a.imag + t.imag) };
+    odd = { static_cast<IntT>(a.real - t.real), static_cast<IntT>(a.imag - t.imag) };
+    extent.extend(even);
+    extent.extend(odd);
+}
+
+template <typename IntT>
+void fixed_stage(
+    std::span<q_complex<IntT>> data,
+    std::span<const q_complex<IntT>> twiddles,
+    std::size_t stride,
+    int shift,
+    q_extent<IntT>& extent
+) {
+    const std::size_t half = stride / 2;
+    for (std::size_t offset = 0; offset < data.size(); offset += stride) {
+        for (std::size_t k = 0; k != half; ++k) {
+            fixed_butterfly(data[offset + k], data[offset + k + half], twiddles[k], shift, extent);
+        }
+    }
+}
+
+#if defined(SL_CALC_FIXED_FFT_SSSE3)
+inline bool cpu_supports_ssse3() {
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("ssse3") != 0;
+    }();
+    return supported;
+}
+
+// 4 butterflies at a time, bit-exact with `fixed_stage`:
+// $$ \omega O $$ is two rounding multiply-highs against w and its swapped pairs, combined with horizontal sub/add
+// only to be called when `cpu_supports_ssse3()`
+__attribute__((target("ssse3"))) inline void fixed_stage_ssse3(
+    std::span<q_complex<std::int16_t>> data,
+    std::span<const q_complex<std::int16_t>> twiddles,
+    std::size_t stride,
+    int shift,
+    q_extent<std::int16_t>& extent
+) {
+    static_assert(sizeof(q_complex<std::int16_t>) == 2 * sizeof(std::int16_t));
+    constexpr std::size_t lanes = sizeof(__m128i) / sizeof(q_complex<std::int16_t>);
+    constexpr int swap_pairs = _MM_SHUFFLE(2, 3, 0, 1);
+
+    const std::size_t half = stride / 2;
+    const __m128i shift_scale = _mm_set1_epi16(static_cast<std::int16_t>(1 << (q_fraction_bits<std::int16_t> - shift)));
+    __m128i min = _mm_set1_epi16(extent.min);
+    __m128i max = _mm_set1_epi16(extent.max);
+
+    for (std::size_t offset = 0; offset < data.size(); offset += stride) {
+        for (std::size_t k = 0; k != half; k += lanes) {
+            auto* const even_ptr = reinterpret_cast<__m128i*>(data.data() + offset + k);
+            auto* const odd_ptr = reinterpret_cast<__m128i*>(data.data() + offset + k + half);
+            __m128i a = _mm_loadu_si128(even_ptr);
+            __m128i b = _mm_loadu_si128(odd_ptr);
+            if (shift != 0) {
+                a = _mm_mulhrs_epi16(a, shift_scale);
+                b = _mm_mulhrs_epi16(b, shift_scale);
+            }
+
+            const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(twiddles.data() + k));
+            const __m128i w_swapped = _mm_shufflehi_epi16(_mm_shufflelo_epi16(w, swap_pairs), swap_pairs);
+            // [b.re w.re, b.im w.im, ...] and [b.re w.im, b.im w.re, ...]
+            const __m128i straight = _mm_mulhrs_epi16(b, w);
+            const __m128i crossed = _mm_mulhrs_epi16(b, w_swapped);
+            const __m128i t = _mm_unpacklo_epi16(_mm_hsub_epi16(straight, straight), _mm_hadd_epi16(crossed, crossed));
+
+            const __m128i x_even = _mm_add_epi16(a, t);
+            const __m128i x_odd = _mm_sub_epi16(a, t);
+            _mm_storeu_si128(even_ptr, x_even);
+            _mm_storeu_si128(odd_ptr, x_odd);
+            min = _mm_min_epi16(min, _mm_min_epi16(x_even, x_odd));
+            max = _mm_max_epi16(max, _mm_max_epi16(x_even, x_odd));
+        }
+    }
+
+    alignas(sizeof(__m128i)) std::int16_t min_lanes[2 * lanes];
+    alignas(sizeof(__m128i)) std::int16_t max_lanes[2 * lanes];
+    _mm_store_si128(reinterpret_cast<__m128i*>(min_lanes), min);
+    _mm_store_si128(reinterpret_cast<__m128i*>(max_lanes), max);
+    extent.min = *std::min_element(std::begin(min_lanes), std::end(min_lanes));
+    extent.max = *std::max_element(std::begin(max_lanes), std::end(max_lanes));
+}
+#endif
+
+// decimation-in-time with block floating point: before every stage the data is shifted right just enough
+// to keep the butterflies from overflowing, judging by the extent tracked while storing the previous stage
+// returns the exponent of the result
+template <direction direction_, typename IntT>
+int fixed_fft_impl(
+    std::span<const q_complex<IntT>> in,
+    std::span<q_complex<IntT>> out,
+    std::span<const q_complex<IntT>> twiddles
+) {
+    const std::size_t N = in.size();
+    const auto half_N_bit_width = static_cast<std::size_t>(std::bit_width(N >> 1));
+
+    q_extent<IntT> extent;
+    for (std::size_t k = 0; k < N; ++k) {
+        out[k] = in[bitswap(k, half_N_bit_width)];
+        extent.extend(out[k]);
+    }
+
+    int exponent = 0;
+    for (std::size_t stride = 2; stride <= N; stride <<= 1) {
+        const int shift = extent.stage_shift();
+        exponent += shift;
+        extent = {};
+        const auto stage_twiddles = twiddles.subspan(stride / 2 - 1, stride / 2);
+#if defined(SL_CALC_FIXED_FFT_SSSE3)
+        if constexpr (std::is_same_v<IntT, std::int16_t>) {
+            if (stride / 2 >= 4 && cpu_supports_ssse3()) {
+                fixed_stage_ssse3(out, stage_twiddles, stride, shift, extent);
+                continue;
+            }
+        }
+#endif
+        fixed_stage(out, stage_twiddles, stride, shift, extent);
+    }
+
+    if constexpr (direction_ == direction::freq_to_time) {
+        // 1/N costs nothing in block floating point
+        exponent -= std::countr_zero(N);
+    }
+    return exponent;
+}
+
+} // namespace detail
+
+// Precomputed fixed-point transform of a fixed size N over Q15 (int16_t) or Q31 (int32_t) complex samples.
+// Butterflies round like the packed 16-bit multiply-high, the int16_t path is vectorized with it on x86 with SSSE3,
+// the int32_t one is scalar over 64-bit intermediates.
+template <direction direction_, typename IntT>
+    requires q_format<IntT>
+class fixed_fft_plan {
+public:
+    explicit fixed_fft_plan(std::size_t N) : N_{ N }, twiddles_{ detail::make_fixed_twiddles<direction_, IntT>(N) } {
+        ASSERT(std::has_single_bit(N), "only accepting powers of 2");
+    }
+
+    [[nodiscard]] std::size_t size() const { return N_; }
+
+    // returns the exponent of `out`, see `fixed_fft_result`
+    int transform(std::span<const q_complex<IntT>> in, std::span<q_complex<IntT>> out) const {
+        ASSERT(in.size() == N_ && out.size() == N_, "plan is made for a different size");
+        ASSERT(in.data() != out.data(), "transform can't be done in-place");
+        return detail::fixed_fft_impl<direction_>(in, out, std::span<const q_complex<IntT>>{ twiddles_ });
+    }
+
+    fixed_fft_result<IntT> transform(std::span<const q_complex<IntT>> in) const {
+        std::vector<q_complex<IntT>> values(N_);
+        const int exponent = transform(in, std::span{ values });
+        return { std::move(values), exponent };
+    }
+
+private:
+    std::size_t N_;
+    std::vector<q_complex<IntT>> twiddles_;
+};
+
+template <direction direction_, typename IntT, std::size_t extent_>
+    requires q_format<IntT> && detail::extent_is_power_of_2<extent_>
+fixed_fft_result<IntT> fixed_fft(std::span<const q_complex<IntT>, extent_> in) {
+    const std::size_t N = in.size();
+    ASSERT(std::has_single_bit(N), "only accepting powers of 2");
+
+    return fixed_fft_plan<direction_, IntT>{ N }.transform(in);
+}
+
+// block floating point result back to floating point, in the units of the Q-format input
+template <typename FloatT, typename IntT>
+    requires std::is_floating_point_v<FloatT> && q_format<IntT>
+std::vector<std::complex<FloatT>> rescale(const fixed_fft_result<IntT>& result) {
+    const int exponent = result.exponent - detail::q_fraction_bits<IntT>;
+    std::vector<std::complex<FloatT>> out(result.values.size());
+    for (std::size_t k = 0; k != out.size(); ++k) {
+        out[k] = {
+            std::ldexp(static_cast<FloatT>(result.values[k].real), exponent),
+            std::ldexp(static_cast<FloatT>(result.values[k].imag), exponent),
+        };
+    }
+    return out;
+}
+
+} // namespace sl::calc::fourier
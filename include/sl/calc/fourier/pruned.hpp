@@ -0,0 +1,312 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <complex>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "sl/calc/bits.hpp"
+#include "sl/calc/fourier/detail.hpp"
+#include "sl/calc/fourier/fast.hpp"
+
+#include <sl/meta/assert.hpp>
+
+namespace sl::calc::fourier {
+namespace detail {
+
+// $$ \omega_N^j $$ for any j, from the first N/2 powers
+template <typename FloatT>
+std::complex<FloatT> twiddle_at(std::span<const std::complex<FloatT>> twiddles, std::size_t j) {
+    const std::size_t half_N = twiddles.size();
+    j &= 2 * half_N - 1;
+    return j < half_N ? twiddles[j] : -twiddles[j - half_N];
+}
+
+// residues transformed side by side, so that strided gathers and scatters of neighbouring residues share cache lines
+template <typename FloatT>
+constexpr std::size_t pruned_lanes = 128 / sizeof(std::complex<FloatT>);
+
+// $$ E_k \mathrel{+}= \omega_s^k O_k $$, first `size` outputs of a DIT stage of size s, `twiddles` are $$ \omega_s^k $$
+template <typename FloatT>
+void pruned_combine(
+    std::complex<FloatT>* even,
+    const std::complex<FloatT>* odd,
+    const std::complex<FloatT>* twiddles,
+    std::size_t size
+) {
+    for (std::size_t k = 0; k != size; ++k) {
+        even[k] += twiddle_multiply(twiddles[k], odd[k]);
+    }
+}
+
+// $$ y_n = \omega_s^n x_n $$, samples of the odd outputs of a DIF stage of size s, with the upper half known to be zero
+template <typename FloatT>
+void pruned_split(
+    std::complex<FloatT>* odd,
+    const std::complex<FloatT>* in,
+    const std::complex<FloatT>* twiddles,
+    std::size_t size
+) {
+    for (std::size_t n = 0; n != size; ++n) {
+        odd[n] = twiddle_multiply(twiddles[n], in[n]);
+    }
+}
+
+} // namespace detail
+
+// Transforms of size N that skip the butterflies on known zeros or on unused bins, in O(N log L) and O(N log M).
+// Input-pruned: only the first L samples are non-zero, so the first log2(N/L) DIF stages have nothing to add,
+// every split only twiddles the L samples of the odd half. Residues r of the outputs are the leaves,
+// $$ X_{r + P s} = \sum_{n < L} (x_n \omega_N^{n r}) \omega_L^{n s} $$, P = N / L, each a transform of size L.
+// Output-pruned: only the first M bins are needed, so the last log2(N/M) DIT stages only compute those.
+// Residues p of the inputs are the leaves, $$ Y_{p, k} = \sum_{q < M} x_{P q + p} \omega_M^{q k} $$, P = N / M.
+// Splits and merges walk a binary tree depth-first, keeping one buffer per level, and twiddles come contiguously from
+// the stage tables. The lowest bits of the residues are done in lanes: neighbouring samples x_{P q + p} are gathered
+// together and neighbouring bins X_{r + P s} are stored together. L and M are rounded up to powers of 2 internally.
+template <direction direction_, typename FloatT>
+    requires std::is_floating_point_v<FloatT>
+class pruned_fft_plan {
+public:
+    explicit pruned_fft_plan(std::size_t N) : N_{ N }, twiddles_{ detail::make_twiddles<direction_, FloatT>(N) } {
+        ASSERT(std::has_single_bit(N), "only accepting powers of 2");
+    }
+
+    [[nodiscard]] std::size_t size() const { return N_; }
+
+    // `in` holds the first L <= N samples, the rest are zero, `out` has N bins
+    void transform_input_pruned(std::span<const std::complex<FloatT>> in, std::span<std::complex<FloatT>> out) const {
+        ASSERT(in.size() <= N_ && out.size() == N_, "plan is made for a different size");
+        if (in.empty()) {
+            std::fill(out.begin(), out.end(), std::complex<FloatT>{});
+            return;
+        }
+        const std::size_t L = std::bit_ceil(in.size());
+        const std::size_t lanes = std::min(detail::pruned_lanes<FloatT>, N_ / L);
+        const auto levels = static_cast<std::size_t>(std::countr_zero(N_ / lanes / L));
+        const auto last_twiddles = detail::stage_twiddles(std::span<const std::complex<FloatT>>{ twiddles_ }, N_);
+
+        // lane j holds $$ x_n \omega_N^{n j} $$, a transform of size N / lanes is left for each
+        const auto lane_sample = [in, last_twiddles](std::size_t j, std::size_t n) {
+            if (n >= in.size()) {
+                return std::complex<FloatT>{};
+            }
+            return j == 0 ? in[n] : detail::twiddle_multiply(detail::twiddle_at(last_twiddles, n * j), in[n]);
+        };
+        if (levels == 0) {
+            // nothing to split, the lanes are loaded straight into the leaves
+            std::vector<std::complex<FloatT>> leaf(lanes * L);
+            const input_pruned_layout layout{ L, lanes, 0, leaf.data(), out };
+            transform_leaf(layout, leaf.data(), 0, lane_sample);
+            return;
+        }
+
+        // one buffer of lanes per level of splits, one more for the leaves
+        std::vector<std::complex<FloatT>> buffers((levels + 2) * lanes * L);
+        for (std::size_t j = 0; j != lanes; ++j) {
+            std::complex<FloatT>* const lane = buffers.data() + j * L;
+            for (std::size_t n = 0; n != in.size(); ++n) {
+                lane[n] = lane_sample(j, n);
+            }
+        }
+        const input_pruned_layout layout{ L, lanes, levels, buffers.data(), out };
+        split_input_pruned(layout, 0, N_ / lanes, 0, 1);
+    }
+
+    // `in` holds all N samples, `out` receives the first M <= N bins
+    void transform_output_pruned(std::span<const std::complex<FloatT>> in, std::span<std::complex<FloatT>> out) const {
+        ASSERT(in.size() == N_ && out.size() <= N_, "plan is made for a different size");
+        if (out.empty()) {
+            return;
+        }
+        const std::size_t M = std::bit_ceil(out.size());
+        const std::size_t lanes = std::min(detail::pruned_lanes<FloatT>, N_ / M);
+        const std::size_t leaves = N_ / M / lanes;
+        const auto levels = static_cast<std::size_t>(std::countr_zero(leaves));
+
+        // one buffer of lanes per level of merges
+        std::vector<std::complex<FloatT>> buffers((levels + 1) * lanes * M);
+        const output_pruned_layout layout{ M, lanes, leaves, buffers.data(), in };
+        merge_output_pruned(layout, 0, 0, leaves);
+
+        // lane j holds the first M bins of $$ x_{lanes \cdot n + j} $$, merged over j, in bit-reversed order
+        const std::span<const std::complex<FloatT>> twiddles = twiddles_;
+        const auto lane_bit_width = static_cast<std::size_t>(std::bit_width(lanes >> 1));
+        const auto lane_at = [&](std::size_t position) { return buffers.data() + bitswap(position, lane_bit_width) * M; };
+        for (std::size_t lane_stride = 2; lane_stride <= lanes; lane_stride <<= 1) {
+            const auto stage_twiddles = detail::stage_twiddles(twiddles, N_ / lanes * lane_stride);
+            for (std::size_t offset = 0; offset < lanes; offset += lane_stride) {
+                for (std::size_t a = 0; a != lane_stride / 2; ++a) {
+                    detail::pruned_combine(
+                        lane_at(offset + a), lane_at(offset + a + lane_stride / 2), stage_twiddles.data(), M
+                    );
+                }
+            }
+        }
+
+        const FloatT scale = normalization();
+        for (std::size_t k = 0; k != out.size(); ++k) {
+            out[k] = buffers[k] * scale;
+        }
+    }
+
+private:
+    struct input_pruned_layout {
+        std::size_t L;
+        std::size_t lanes;
+        std::size_t levels;
+        std::complex<FloatT>* buffers;
+        std::span<std::complex<FloatT>> out;
+
+        [[nodiscard]] std::complex<FloatT>* level(std::size_t l) const { return buffers + l * lanes * L; }
+    };
+
+    struct output_pruned_layout {
+        std::size_t M;
+        std::size_t lanes;
+        std::size_t leaves;
+        std::complex<FloatT>* buffers;
+        std::span<const std::complex<FloatT>> in;
+
+        [[nodiscard]] std::complex<FloatT>* level(std::size_t l) const { return buffers + l * lanes * M; }
+    };
+
+    // DIF over the residues r = j + lanes t, the node of segment size s holds its L samples at `level`:
+    // even bins are a transform of the same samples, odd ones of the samples twiddled by $$ \omega_s^n $$
+    void split_input_pruned(
+        const input_pruned_layout& layout,
+        std::size_t level,
+        std::size_t segment_size,
+        std::size_t t,
+        std::size_t t_bit
+    ) const {
+        const std::size_t L = layout.L;
+        const std::size_t lanes = layout.lanes;
+        const std::span<const std::complex<FloatT>> twiddles = twiddles_;
+        std::complex<FloatT>* const samples = layout.level(level);
+        if (segment_size == L) {
+            transform_leaf(layout, layout.level(layout.levels + 1), t, [samples, L](std::size_t j, std::size_t n) {
+                return samples[j * L + n];
+            });
+            return;
+        }
+
+        split_input_pruned(layout, level, segment_size / 2, t, t_bit << 1);
+        std::complex<FloatT>* const odd_samples = layout.level(level + 1);
+        const auto stage_twiddles = detail::stage_twiddles(twiddles, segment_size);
+        for (std::size_t j = 0; j != lanes; ++j) {
+            detail::pruned_split(odd_samples + j * L, samples + j * L, stage_twiddles.data(), L);
+        }
+        split_input_pruned(layout, level + 1, segment_size / 2, t + t_bit, t_bit << 1);
+    }
+
+    // transforms of size L of `lane_sample(j, n)` in `leaf`, then stored as $$ X_{j + lanes \cdot t + P s} $$,
+    // the lanes of a bin next to each other
+    template <typename LaneSampleF>
+    void transform_leaf(
+        const input_pruned_layout& layout,
+        std::complex<FloatT>* leaf,
+        std::size_t t,
+        LaneSampleF&& lane_sample
+    ) const {
+        const std::size_t L = layout.L;
+        const std::size_t lanes = layout.lanes;
+        const std::span<const std::complex<FloatT>> twiddles = twiddles_;
+        // bit-reversal as a scatter, so that samples and their twiddles are read in natural order
+        const auto half_L_bit_width = static_cast<std::size_t>(std::bit_width(L >> 1));
+        for (std::size_t n = 0; n != L; ++n) {
+            const std::size_t n_bitswapped = bitswap(n, half_L_bit_width);
+            for (std::size_t j = 0; j != lanes; ++j) {
+                leaf[j * L + n_bitswapped] = lane_sample(j, n);
+            }
+        }
+        for (std::size_t j = 0; j != lanes; ++j) {
+            const std::span<std::complex<FloatT>> leaf_lane{ leaf + j * L, L };
+            detail::fft_butterflies(leaf_lane, twiddles, [leaf_lane](std::size_t s, const std::complex<FloatT>& x) {
+                leaf_lane[s] = x;
+            });
+        }
+        const std::size_t P = N_ / L;
+        const FloatT scale = normalization();
+        for (std::size_t s = 0; s != L; ++s) {
+            std::complex<FloatT>* const bins = layout.out.data() + lanes * t + P * s;
+            for (std::size_t j = 0; j != lanes; ++j) {
+                bins[j] = leaf[j * L + s] * scale;
+            }
+        }
+    }
+
+    // DIT over the residues p = j + lanes t, leaves come in bit-reversed order of t,
+    // the node spanning `leaf_count` of them leaves the first M bins of its segment at `level`
+    void merge_output_pruned(
+        const output_pruned_layout& layout,
+        std::size_t level,
+        std::size_t leaf_begin,
+        std::size_t leaf_count
+    ) const {
+        const std::size_t M = layout.M;
+        const std::size_t lanes = layout.lanes;
+        const std::span<const std::complex<FloatT>> twiddles = twiddles_;
+        std::complex<FloatT>* const bins = layout.level(level);
+        if (leaf_count == 1) {
+            // $$ x_{P q + lanes \cdot t + j} $$, the lanes of a sample are loaded next to each other
+            const std::size_t P = N_ / M;
+            const std::size_t t = bitswap(leaf_begin, static_cast<std::size_t>(std::bit_width(layout.leaves >> 1)));
+            const auto half_M_bit_width = static_cast<std::size_t>(std::bit_width(M >> 1));
+            for (std::size_t q = 0; q != M; ++q) {
+                const std::complex<FloatT>* const samples = layout.in.data() + P * q + lanes * t;
+                const std::size_t q_bitswapped = bitswap(q, half_M_bit_width);
+                for (std::size_t j = 0; j != lanes; ++j) {
+                    bins[j * M + q_bitswapped] = samples[j];
+                }
+            }
+            for (std::size_t j = 0; j != lanes; ++j) {
+                const std::span<std::complex<FloatT>> lane{ bins + j * M, M };
+                detail::fft_butterflies(lane, twiddles, [lane](std::size_t k, const std::complex<FloatT>& x) { lane[k] = x; });
+            }
+            return;
+        }
+
+        const std::size_t half = leaf_count / 2;
+        merge_output_pruned(layout, level, leaf_begin, half);
+        merge_output_pruned(layout, level + 1, leaf_begin + half, half);
+        const std::complex<FloatT>* const odd_bins = layout.level(level + 1);
+        const auto stage_twiddles = detail::stage_twiddles(twiddles, M * leaf_count);
+        for (std::size_t j = 0; j != lanes; ++j) {
+            detail::pruned_combine(bins + j * M, odd_bins + j * M, stage_twiddles.data(), M);
+        }
+    }
+
+    [[nodiscard]] FloatT normalization() const {
+        return direction_ == direction::freq_to_time ? FloatT{ 1 } / static_cast<FloatT>(N_) : FloatT{ 1 };
+    }
+
+private:
+    std::size_t N_;
+    std::vector<std::complex<FloatT>> twiddles_;
+};
+
+// same as `fft` of `in` zero-padded to N
+template <direction direction_, typename FloatT, std::size_t extent_>
+    requires std::is_floating_point_v<FloatT>
+std::vector<std::complex<FloatT>> fft_input_pruned(std::span<const std::complex<FloatT>, extent_> in, std::size_t N) {
+    std::vector<std::complex<FloatT>> out(N);
+    pruned_fft_plan<direction_, FloatT>{ N }.transform_input_pruned(in, std::span{ out });
+    return out;
+}
+
+// same as the first M bins of `fft` of `in`
+template <direction direction_, typename FloatT, std::size_t extent_>
+    requires std::is_floating_point_v<FloatT> && detail::extent_is_power_of_2<extent_>
+std::vector<std::complex<FloatT>> fft_output_pruned(std::span<const std::complex<FloatT>, extent_> in, std::size_t M) {
+    std::vector<std::complex<FloatT>> out(M);
+    pruned_fft_plan<direction_, FloatT>{ in.size() }.transform_output_pruned(in, std::span{ out });
+    return out;
+}
+
+} // namespace sl::calc::fourier
@@ -0,0 +1,102 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#pragma once
+
+#include <complex>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "sl/calc/fourier/detail.hpp"
+#include "sl/calc/fourier/fast.hpp"
+
+#include <sl/meta/assert.hpp>
+
+namespace sl::calc::fourier {
+namespace detail {
+
+// $$ Z_k = FFT_{N/2}(x_{2n} + i x_{2n + 1}) $$, packing is fused into the bit-reversal permutation
+template <typename FloatT>
+void real_fft_packed(
+    std::span<const FloatT> in,
+    std::span<std::complex<FloatT>> packed,
+    std::span<const std::complex<FloatT>> twiddles
+) {
+    fft_permute(packed, [in](std::size_t n) { return std::complex<FloatT>{ in[2 * n], in[2 * n + 1] }; });
+    fft_butterflies(packed, twiddles, [packed](std::size_t k, const std::complex<FloatT>& x) { packed[k] = x; });
+}
+
+// X_k, 0 <= k <= N/2, of the real input from its packed spectrum, handed to `store(k, X_k)` in natural order,
+// with M = N/2, `twiddles` are $$ \omega_N^k $$ for k < M
+// $$ E_k = \frac{Z_k + \overline{Z_{M - k}}}{2} $$, $$ O_k = \frac{Z_k - \overline{Z_{M - k}}}{2 i} $$,
+// $$ X_k = E_k + \omega_N^k O_k $$
+// reads the packed spectrum from both ends, sequentially, and multiplies through `twiddle_multiply`
+template <typename FloatT, typename StoreF>
+void real_fft_unpack(
+    std::span<const std::complex<FloatT>> packed,
+    std::span<const std::complex<FloatT>> twiddles,
+    StoreF&& store
+) {
+    const std::size_t M = packed.size();
+    const std::complex<FloatT>* const z = packed.data();
+    const std::complex<FloatT>* const w = twiddles.data();
+    const FloatT half{ 0.5 };
+    for (std::size_t k = 0; k != M; ++k) {
+        const std::complex<FloatT> z_k = z[k];
+        const std::complex<FloatT> z_mirrored = z[(M - k) & (M - 1)];
+        // $$ \overline{Z_{M - k}} $$ is spelled out, so is the division by 2 i
+        const std::complex<FloatT> even{ (z_k.real() + z_mirrored.real()) * half, (z_k.imag() - z_mirrored.imag()) * half };
+        const std::complex<FloatT> odd{ (z_k.imag() + z_mirrored.imag()) * half, (z_mirrored.real() - z_k.real()) * half };
+        store(k, even + twiddle_multiply(w[k], odd));
+    }
+    store(M, std::complex<FloatT>{ z[0].real() - z[0].imag(), FloatT{ 0 } });
+}
+
+} // namespace detail
+
+// Forward transform of N real samples as a complex one of N/2, N/2 + 1 bins out of N,
+// the rest are their complex conjugates: $$ X_{N - k} = \overline{X_k} $$.
+template <typename FloatT>
+    requires std::is_floating_point_v<FloatT>
+class real_fft_plan {
+public:
+    explicit real_fft_plan(std::size_t N) : N_{ N }, twiddles_{ detail::make_twiddles<direction::time_to_freq, FloatT>(N) } {
+        ASSERT(std::has_single_bit(N) && N >= 2, "only accepting powers of 2 from 2");
+    }
+
+    [[nodiscard]] std::size_t size() const { return N_; }
+    [[nodiscard]] std::size_t bin_count() const { return N_ / 2 + 1; }
+
+    void transform(std::span<const FloatT> in, std::span<std::complex<FloatT>> out) const {
+        ASSERT(in.size() == N_ && out.size() == bin_count(), "plan is made for a different size");
+        const std::span<const std::complex<FloatT>> twiddles = twiddles_;
+
+        std::vector<std::complex<FloatT>> packed(N_ / 2);
+        detail::real_fft_packed(in, std::span{ packed }, twiddles);
+        detail::real_fft_unpack(
+            std::span<const std::complex<FloatT>>{ packed },
+            detail::stage_twiddles(twiddles, N_),
+            [out](std::size_t k, const std::complex<FloatT>& x) { out[k] = x; }
+        );
+    }
+
+    std::vector<std::complex<FloatT>> transform(std::span<const FloatT> in) const {
+        std::vector<std::complex<FloatT>> out(bin_count());
+        transform(in, std::span{ out });
+        return out;
+    }
+
+private:
+    std::size_t N_;
+    std::vector<std::complex<FloatT>> twiddles_;
+};
+
+template <typename FloatT, std::size_t extent_>
+    requires std::is_floating_point_v<FloatT> && detail::extent_is_power_of_2<extent_>
+std::vector<std::complex<FloatT>> rfft(std::span<const FloatT, extent_> in) {
+    return real_fft_plan<FloatT>{ in.size() }.transform(in);
+}
+
+} // namespace sl::calc::fourier
@@ -0,0 +1,238 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "sl/calc/fourier/detail.hpp"
+#include "sl/calc/fourier/fast.hpp"
+
+#include <sl/meta/assert.hpp>
+
+namespace sl::calc::fourier {
+
+template <typename FloatT>
+    requires std::is_floating_point_v<FloatT>
+struct sparse_coefficient {
+    std::size_t index;
+    std::complex<FloatT> value;
+};
+
+template <typename FloatT>
+    requires std::is_floating_point_v<FloatT>
+struct sparse_fft_result {
+    // the k largest coefficients, by magnitude
+    std::vector<sparse_coefficient<FloatT>> coefficients;
+    // hashing didn't recover the spectrum within its budget and the coefficients come from the dense `fft`
+    bool dense_fallback = false;
+};
+
+template <typename FloatT>
+    requires std::is_floating_point_v<FloatT>
+struct sparse_fft_options {
+    // hashing rounds, each doubling the amount of buckets, before falling back to the dense fft
+    std::size_t max_rounds = 8;
+    // residual energy, relative to the energy of a round's subsample, below which the spectrum is considered recovered
+    FloatT tolerance = static_cast<FloatT>(1e-9);
+};
+
+namespace detail {
+
+template <typename FloatT>
+std::vector<sparse_coefficient<FloatT>> top_coefficients(std::vector<sparse_coefficient<FloatT>> coefficients, std::size_t k) {
+    const auto by_magnitude = [](const sparse_coefficient<FloatT>& a, const sparse_coefficient<FloatT>& b) {
+        return std::norm(a.value) > std::norm(b.value);
+    };
+    const std::size_t top = std::min(k, coefficients.size());
+    std::partial_sort(coefficients.begin(), coefficients.begin() + static_cast<std::ptrdiff_t>(top), coefficients.end(), by_magnitude);
+    coefficients.resize(top);
+    return coefficients;
+}
+
+template <direction direction_, typename FloatT, std::size_t extent_>
+std::vector<sparse_coefficient<FloatT>> dense_top_coefficients(std::span<const std::complex<FloatT>, extent_> in, std::size_t k) {
+    const auto out = fft<direction_>(in);
+    std::vector<sparse_coefficient<FloatT>> coefficients(out.size());
+    for (std::size_t f = 0; f != out.size(); ++f) {
+        coefficients[f] = { f, out[f] };
+    }
+    return top_coefficients(std::move(coefficients), k);
+}
+
+} // namespace detail
+
+// Recovers the k largest coefficients of a spectrum with few significant ones (sFFT-style), sublinear in N.
+// Every round hashes the spectrum into B buckets by subsampling with stride L = N/B, so that X_f aliases into f mod B.
+// Subsamples shifted by s = 1, 2, 4, ..., L/2 samples rotate a lone coefficient by $$ e^{i 2 \pi \frac{f s}{N}} $$,
+// which reveals the remaining bits of f one by one, each with half a turn of margin against noise.
+// Recovered coefficients are peeled off from the buckets of the following rounds.
+// Coefficients congruent modulo B collide for any odd dilation of the spectrum when N is a power of 2,
+// so instead of permuting, every round doubles B, starting at ~2k.
+// Round with B buckets costs O(B log B log L), falls back to the dense `fft` when the residual does not vanish
+// within a fraction of the dense cost, meaning the spectrum is not k-sparse at the given tolerance,
+// or that its coefficients collide modulo the finest B the budget affords.
+template <direction direction_, typename FloatT, std::size_t extent_>
+    requires std::is_floating_point_v<FloatT> && detail::extent_is_power_of_2<extent_>
+sparse_fft_result<FloatT> sparse_fft(
+    std::span<const std::complex<FloatT>, extent_> in,
+    std::size_t k,
+    const sparse_fft_options<FloatT>& options = {}
+) {
+    const std::size_t N = in.size();
+    ASSERT(std::has_single_bit(N), "only accepting powers of 2");
+    ASSERT(k > 0, "k has to be positive");
+
+    const std::size_t mask = N - 1;
+    // a lone coefficient at f turns a shift by s samples into $$ e^{i 2 \pi \frac{f s}{N}} $$ for `time_to_freq`
+    const FloatT shift_sign = -detail::direction_sign_v<direction_, FloatT>;
+    const auto turns = [N](std::size_t numerator) { return static_cast<FloatT>(numerator) / static_cast<FloatT>(N); };
+    const auto circular_distance = [](FloatT a, FloatT b) {
+        const FloatT d = std::abs(a - b);
+        return std::min(d, FloatT{ 1 } - d);
+    };
+    // Z[0] is the unshifted subsample, Z[i] is shifted by 2^(i - 1)
+    const auto shift = [](std::size_t i) { return i == 0 ? std::size_t{ 0 } : std::size_t{ 1 } << (i - 1); };
+
+    std::unordered_map<std::size_t, std::complex<FloatT>> found;
+    std::vector<std::complex<FloatT>> subsample;
+    std::vector<std::vector<std::complex<FloatT>>> Z;
+
+    // hashing gives up once it has spent a fraction of what the dense fft would, in butterflies,
+    // strided gathers of the subsamples miss the cache far more often than the dense fft does
+    const auto butterflies = [](std::size_t n) { return n * static_cast<std::size_t>(std::countr_zero(n)); };
+    const std::size_t budget = butterflies(N) / 8;
+    std::size_t spent = 0;
+
+    bool converged = false;
+    std::size_t B = std::bit_ceil(2 * k);
+    for (std::size_t round = 0; round != options.max_rounds && B <= N / 4; ++round, B <<= 1) {
+        const std::size_t L = N / B;
+        const auto L_bit_width = static_cast<std::size_t>(std::countr_zero(L));
+        spent += (L_bit_width + 1) * butterflies(B);
+        if (spent > budget) {
+            break;
+        }
+        // Z_b in units of the output, for `freq_to_time` the 1/B of the subsample transform already takes care of it
+        // $$ Z_b = \frac{B}{N} \sum_{f \equiv b \pmod B} X_f $$
+        const FloatT bucket_scale =
+            direction_ == direction::time_to_freq ? static_cast<FloatT>(B) / static_cast<FloatT>(N) : FloatT{ 1 };
+
+        // every shifted subsample is an estimate of the same coefficient, averaging them suppresses noise
+        const auto estimate = [&Z, &shift, B, bucket_scale, mask, N](std::size_t f) {
+            std::complex<FloatT> value{};
+            for (std::size_t i = 0; i != Z.size(); ++i) {
+                value += Z[i][f % B]
+                         * detail::polar(detail::theta<direction_, FloatT>((f * shift(i)) & mask, N));
+            }
+            return value / (bucket_scale * static_cast<FloatT>(Z.size()));
+        };
+
+        const fft_plan<direction_, FloatT> plan{ B };
+        subsample.resize(B);
+        Z.resize(L_bit_width + 1);
+        for (std::size_t i = 0; i != Z.size(); ++i) {
+            for (std::size_t j = 0; j != B; ++j) {
+                subsample[j] = in[j * L + shift(i)];
+            }
+            Z[i].resize(B);
+            plan.transform(subsample, Z[i]);
+        }
+
+        FloatT energy = 0;
+        for (const auto& x : Z[0]) {
+            energy += std::norm(x);
+        }
+
+        // drop what turned out to be insignificant, e.g. mistaken for a lone coefficient and then cancelled out
+        const FloatT threshold = options.tolerance * energy / static_cast<FloatT>(B);
+        std::erase_if(found, [bucket_scale, threshold](const auto& coefficient) {
+            return std::norm(coefficient.second * bucket_scale) <= threshold;
+        });
+
+        // peel off what is already known
+        for (const auto& [f, value] : found) {
+            for (std::size_t i = 0; i != Z.size(); ++i) {
+                const auto rotation = detail::polar(-detail::theta<direction_, FloatT>((f * shift(i)) & mask, N));
+                Z[i][f % B] -= bucket_scale * value * rotation;
+            }
+        }
+
+        FloatT residual = 0;
+        for (const auto& x : Z[0]) {
+            residual += std::norm(x);
+        }
+        // estimates of coefficients sharing a bucket can't be verified, keep going until they are apart
+        std::vector<std::size_t> bucket_occupancy(B);
+        for (const auto& [f, value] : found) {
+            ++bucket_occupancy[f % B];
+        }
+        const bool apart = std::all_of(bucket_occupancy.begin(), bucket_occupancy.end(), [](std::size_t occupancy) {
+            return occupancy <= 1;
+        });
+        if (apart && residual <= options.tolerance * energy) {
+            // buckets are the finest so far, let every coefficient absorb what's left in its bucket,
+            // this fixes estimates that were taken while sharing a bucket with a weaker, yet unknown, coefficient
+            for (auto& [f, value] : found) {
+                value += estimate(f);
+            }
+            converged = true;
+            break;
+        }
+
+        // locate lone coefficients, f = b + B q
+        for (std::size_t b = 0; b != B; ++b) {
+            if (std::norm(Z[0][b]) <= threshold) {
+                continue;
+            }
+
+            bool lone = true;
+            std::size_t q = 0;
+            // shift by 2^j reveals $$ \frac{q \mod 2^{n - j}}{2^{n - j}} $$ turns on top of the known b, n = log2(L)
+            for (std::size_t j = L_bit_width; j-- > 0 && lone;) {
+                const auto ratio = Z[j + 1][b] / Z[0][b];
+                // magnitudes differ when more than one coefficient shares the bucket
+                lone = std::abs(std::abs(ratio) - FloatT{ 1 }) <= static_cast<FloatT>(0.25);
+
+                const FloatT measured = shift_sign * std::arg(ratio) / (2 * std::numbers::pi_v<FloatT>)
+                                        - turns((b << j) & mask) + 1;
+                const FloatT fraction = measured - std::floor(measured);
+                const std::size_t period = L >> j;
+                const std::size_t q_other = q + period / 2;
+                const auto expected = [period](std::size_t candidate) {
+                    return static_cast<FloatT>(candidate) / static_cast<FloatT>(period);
+                };
+                if (circular_distance(fraction, expected(q_other)) < circular_distance(fraction, expected(q))) {
+                    q = q_other;
+                }
+            }
+            if (!lone) {
+                continue;
+            }
+            const std::size_t f = b + B * q;
+            found[f] += estimate(f);
+        }
+    }
+
+    if (!converged) {
+        return { .coefficients = detail::dense_top_coefficients<direction_>(in, k), .dense_fallback = true };
+    }
+
+    std::vector<sparse_coefficient<FloatT>> coefficients;
+    coefficients.reserve(found.size());
+    for (const auto& [f, value] : found) {
+        coefficients.push_back({ f, value });
+    }
+    return { .coefficients = detail::top_coefficients(std::move(coefficients), k), .dense_fallback = false };
+}
+
+} // namespace sl::calc::fourier
@@ -0,0 +1,160 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#pragma once
+
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "sl/calc/fourier/detail.hpp"
+#include "sl/calc/fourier/fast.hpp"
+
+#include <sl/meta/assert.hpp>
+
+namespace sl::calc::fourier {
+
+enum class window {
+    hann,
+    hamming,
+    blackman_harris,
+};
+
+namespace detail {
+
+// periodic (DFT-even) windows, as used for spectral analysis
+// $$ w_n = \sum_j (-1)^j a_j \cos(\frac{2 \pi j n}{N}) $$
+template <typename FloatT>
+    requires std::is_floating_point_v<FloatT>
+std::vector<FloatT> make_window(window kind, std::size_t N) {
+    const auto cosine_sum = [N](std::span<const double> a) {
+        std::vector<FloatT> w(N);
+        for (std::size_t n = 0; n != N; ++n) {
+            const double theta = 2 * std::numbers::pi * static_cast<double>(n) / static_cast<double>(N);
+            double w_n = 0.0;
+            double sign = 1.0;
+            for (std::size_t j = 0; j != a.size(); ++j) {
+                w_n += sign * a[j] * std::cos(static_cast<double>(j) * theta);
+                sign = -sign;
+            }
+            w[n] = static_cast<FloatT>(w_n);
+        }
+        return w;
+    };
+
+    switch (kind) {
+    case window::hann: {
+        constexpr double a[]{ 0.5, 0.5 };
+        return cosine_sum(a);
+    }
+    case window::hamming: {
+        constexpr double a[]{ 0.54, 0.46 };
+        return cosine_sum(a);
+    }
+    case window::blackman_harris: {
+        constexpr double a[]{ 0.35875, 0.48829, 0.14128, 0.01168 };
+        return cosine_sum(a);
+    }
+    }
+    ASSERT(false, "unknown window");
+    return {};
+}
+
+} // namespace detail
+
+// Windowed power spectra over segments of `segment_size` samples, `hop` samples apart.
+// Window and twiddles are precomputed,
+// window multiply is fused into the bit-reversal permutation and |X_k|^2 with scaling into the last butterfly stage,
+// so every segment costs a single FFT worth of memory passes.
+// Densities are normalized by the window power $$ \sum w_n^2 $$ only, divide by the sample rate for physical units.
+template <typename FloatT>
+    requires std::is_floating_point_v<FloatT>
+class spectral_plan {
+public:
+    spectral_plan(window kind, std::size_t segment_size, std::size_t hop)
+        : window_{ detail::make_window<FloatT>(kind, segment_size) },
+          twiddles_{ detail::make_twiddles<direction::time_to_freq, FloatT>(segment_size) }, hop_{ hop } {
+        ASSERT(std::has_single_bit(segment_size), "only accepting powers of 2");
+        ASSERT(hop > 0, "hop has to be positive");
+
+        FloatT window_power = 0;
+        for (const FloatT w : window_) {
+            window_power += w * w;
+        }
+        scale_ = FloatT{ 1 } / window_power;
+    }
+
+    [[nodiscard]] std::size_t segment_size() const { return window_.size(); }
+    [[nodiscard]] std::size_t hop() const { return hop_; }
+    [[nodiscard]] std::span<const FloatT> coefficients() const { return window_; }
+
+    [[nodiscard]] std::size_t segment_count(std::size_t sample_count) const {
+        const std::size_t N = segment_size();
+        return sample_count < N ? 0 : 1 + (sample_count - N) / hop_;
+    }
+
+    // Welch's method: power spectral density averaged over all segments, `segment_size` bins
+    template <std::size_t extent_>
+    std::vector<FloatT> welch(std::span<const std::complex<FloatT>, extent_> in) const {
+        const std::size_t segments = segment_count(in.size());
+        ASSERT(segments > 0, "not enough samples for a single segment");
+
+        std::vector<FloatT> psd(segment_size());
+        const FloatT scale = scale_ / static_cast<FloatT>(segments);
+        for_each_segment(in, [&psd, scale](std::size_t, std::size_t k, const std::complex<FloatT>& x) {
+            psd[k] += std::norm(x) * scale;
+        });
+        return psd;
+    }
+
+    // power spectral density of every segment, row-major: `segment_count` rows of `segment_size` bins
+    template <std::size_t extent_>
+    std::vector<FloatT> spectrogram(std::span<const std::complex<FloatT>, extent_> in) const {
+        const std::size_t N = segment_size();
+        std::vector<FloatT> rows(segment_count(in.size()) * N);
+        const FloatT scale = scale_;
+        for_each_segment(in, [&rows, N, scale](std::size_t segment, std::size_t k, const std::complex<FloatT>& x) {
+            rows[segment * N + k] = std::norm(x) * scale;
+        });
+        return rows;
+    }
+
+private:
+    template <std::size_t extent_, typename StoreF>
+    void for_each_segment(std::span<const std::complex<FloatT>, extent_> in, StoreF&& store) const {
+        const std::size_t N = segment_size();
+        const std::size_t segments = segment_count(in.size());
+        const std::span<const FloatT> w = window_;
+        const std::span<const std::complex<FloatT>> twiddles = twiddles_;
+
+        std::vector<std::complex<FloatT>> scratch(N);
+        const std::span<std::complex<FloatT>> scratch_span{ scratch };
+        for (std::size_t segment = 0; segment != segments; ++segment) {
+            const auto segment_in = in.subspan(segment * hop_, N);
+            detail::fft_permute(scratch_span, [segment_in, w](std::size_t n) { return segment_in[n] * w[n]; });
+            detail::fft_butterflies(
+                scratch_span,
+                twiddles,
+                [&store, segment](std::size_t k, const std::complex<FloatT>& x) { store(segment, k, x); }
+            );
+        }
+    }
+
+private:
+    std::vector<FloatT> window_;
+    std::vector<std::complex<FloatT>> twiddles_;
+    std::size_t hop_;
+    FloatT scale_{};
+};
+
+template <window window_, typename FloatT, std::size_t extent_>
+    requires std::is_floating_point_v<FloatT>
+std::vector<FloatT> welch(std::span<const std::complex<FloatT>, extent_> in, std::size_t segment_size, std::size_t hop) {
+    return spectral_plan<FloatT>{ window_, segment_size, hop }.welch(in);
+}
+
+} // namespace sl::calc::fourier
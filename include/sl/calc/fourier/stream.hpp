@@ -0,0 +1,286 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "sl/calc/fourier/detail.hpp"
+#include "sl/calc/fourier/fast.hpp"
+
+#include <sl/meta/assert.hpp>
+
+namespace sl::calc::fourier {
+namespace detail {
+
+// not using std::hardware_destructive_interference_size, its value is not ABI-stable
+constexpr std::size_t cache_line_size = 64;
+
+template <typename T>
+struct cache_aligned_allocator {
+    using value_type = T;
+
+    cache_aligned_allocator() = default;
+    template <typename U>
+    constexpr cache_aligned_allocator(const cache_aligned_allocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ cache_line_size }));
+    }
+    void deallocate(T* p, std::size_t) noexcept { ::operator delete(p, std::align_val_t{ cache_line_size }); }
+
+    template <typename U>
+    bool operator==(const cache_aligned_allocator<U>&) const noexcept {
+        return true;
+    }
+};
+
+} // namespace detail
+
+// Log2-bucketed latency histogram, bucket i counts latencies in [2^(i-1), 2^i) nanoseconds,
+// the last bucket counts every latency from 2^62 nanoseconds on.
+// Written by a single thread, counters may be read concurrently from any thread.
+class latency_histogram {
+public:
+    using duration = std::chrono::nanoseconds;
+    static constexpr std::size_t bucket_count = 64;
+
+    void record(duration latency) {
+        const auto ns = static_cast<std::uint64_t>(std::max(latency.count(), duration::rep{ 0 }));
+        const auto bucket = std::min(static_cast<std::size_t>(std::bit_width(ns)), bucket_count - 1);
+        buckets_[bucket].fetch_add(1, std::memory_order::relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t count(std::size_t bucket) const {
+        return buckets_[bucket].load(std::memory_order::relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t total() const {
+        std::uint64_t result = 0;
+        for (const auto& bucket : buckets_) {
+            result += bucket.load(std::memory_order::relaxed);
+        }
+        return result;
+    }
+
+    // exclusive upper bound of the latencies counted in `bucket`, the last bucket is unbounded
+    [[nodiscard]] static duration upper_bound(std::size_t bucket) {
+        if (bucket >= bucket_count - 1) {
+            return duration::max();
+        }
+        return duration{ static_cast<duration::rep>(std::uint64_t{ 1 } << bucket) };
+    }
+
+private:
+    std::array<std::atomic<std::uint64_t>, bucket_count> buckets_{};
+};
+
+// Lock-free single-producer/single-consumer ring of fixed-size sample frames.
+// The producer pushes arbitrary chunks of samples, complete frames are published to the consumer,
+// which reads them in-place (zero-copy) until `release`.
+// A producer that finds no free frame drops the whole next frame of samples and counts an overrun instead of blocking.
+template <typename FloatT>
+    requires std::is_floating_point_v<FloatT>
+class frame_ring {
+public:
+    using value_type = std::complex<FloatT>;
+    using clock = std::chrono::steady_clock;
+
+    struct frame {
+        std::span<const value_type> samples;
+        // index of the first sample of this frame in the pushed stream, skips over dropped frames
+        std::uint64_t first_sample;
+    };
+
+    frame_ring(std::size_t frame_size, std::size_t frame_count)
+        : frame_size_{ frame_size }, frame_stride_{ aligned_stride(frame_size) }, frame_count_{ frame_count },
+          storage_(frame_stride_ * frame_count), slots_(frame_count) {
+        ASSERT(frame_size > 0, "frames can't be empty");
+        ASSERT(std::has_single_bit(frame_count), "only accepting powers of 2");
+    }
+
+    [[nodiscard]] std::size_t frame_size() const { return frame_size_; }
+    [[nodiscard]] std::size_t frame_count() const { return frame_count_; }
+
+    // producer side, returns amount of samples accepted, the rest was dropped due to overrun
+    std::size_t push(std::span<const value_type> samples) {
+        std::size_t accepted = 0;
+        while (!samples.empty()) {
+            if (producer_.fill == 0) {
+                producer_.dropping = !has_free_frame();
+                producer_.first_sample = producer_.sample_count;
+                if (producer_.dropping) {
+                    overruns_.fetch_add(1, std::memory_order::relaxed);
+                }
+            }
+
+            const std::size_t chunk = std::min(samples.size(), frame_size_ - producer_.fill);
+            if (!producer_.dropping) {
+                std::copy_n(samples.begin(), chunk, frame_data(producer_.write) + producer_.fill);
+                accepted += chunk;
+            }
+            producer_.fill += chunk;
+            producer_.sample_count += chunk;
+            samples = samples.subspan(chunk);
+
+            if (producer_.fill == frame_size_) {
+                producer_.fill = 0;
+                if (!producer_.dropping) {
+                    publish();
+                }
+            }
+        }
+        return accepted;
+    }
+
+    // consumer side, frame stays valid until `release`, every successful acquire has to be followed by a release
+    std::optional<frame> try_acquire() {
+        if (consumer_.read == consumer_.cached_write) {
+            consumer_.cached_write = write_index_.load(std::memory_order::acquire);
+            if (consumer_.read == consumer_.cached_write) {
+                return std::nullopt;
+            }
+        }
+
+        const slot& acquired = slots_[consumer_.read & (frame_count_ - 1)];
+        latency_.record(clock::now() - acquired.published_at);
+        return frame{
+            .samples = std::span<const value_type>{ frame_data(consumer_.read), frame_size_ },
+            .first_sample = acquired.first_sample,
+        };
+    }
+
+    void release() {
+        ASSERT(consumer_.read != consumer_.cached_write, "nothing to release");
+        read_index_.store(++consumer_.read, std::memory_order::release);
+    }
+
+    // statistics, may be read from any thread
+    [[nodiscard]] std::uint64_t overruns() const { return overruns_.load(std::memory_order::relaxed); }
+    [[nodiscard]] std::uint64_t published() const { return write_index_.load(std::memory_order::relaxed); }
+    [[nodiscard]] std::uint64_t consumed() const { return read_index_.load(std::memory_order::relaxed); }
+    // time between frame publication and its acquisition by the consumer
+    [[nodiscard]] const latency_histogram& latency() const { return latency_; }
+
+private:
+    static std::size_t aligned_stride(std::size_t frame_size) {
+        const std::size_t bytes = frame_size * sizeof(value_type);
+        const std::size_t aligned_bytes = (bytes + detail::cache_line_size - 1) / detail::cache_line_size
+                                          * detail::cache_line_size;
+        return aligned_bytes / sizeof(value_type);
+    }
+
+    value_type* frame_data(std::uint64_t index) {
+        return storage_.data() + (index & (frame_count_ - 1)) * frame_stride_;
+    }
+
+    bool has_free_frame() {
+        if (producer_.write - producer_.cached_read < frame_count_) {
+            return true;
+        }
+        producer_.cached_read = read_index_.load(std::memory_order::acquire);
+        return producer_.write - producer_.cached_read < frame_count_;
+    }
+
+    void publish() {
+        slot& published = slots_[producer_.write & (frame_count_ - 1)];
+        published.first_sample = producer_.first_sample;
+        published.published_at = clock::now();
+        write_index_.store(++producer_.write, std::memory_order::release);
+    }
+
+private:
+    struct slot {
+        std::uint64_t first_sample = 0;
+        clock::time_point published_at;
+    };
+
+    // indices are kept on separate cache lines, each side caches the other one's index to avoid ping-pong
+    struct alignas(detail::cache_line_size) producer_state {
+        std::uint64_t write = 0;
+        std::uint64_t cached_read = 0;
+        std::size_t fill = 0;
+        std::uint64_t sample_count = 0;
+        std::uint64_t first_sample = 0;
+        bool dropping = false;
+    };
+
+    struct alignas(detail::cache_line_size) consumer_state {
+        std::uint64_t read = 0;
+        std::uint64_t cached_write = 0;
+    };
+
+    std::size_t frame_size_;
+    std::size_t frame_stride_;
+    std::size_t frame_count_;
+    std::vector<value_type, detail::cache_aligned_allocator<value_type>> storage_;
+    std::vector<slot> slots_;
+
+    producer_state producer_;
+    consumer_state consumer_;
+    alignas(detail::cache_line_size) std::atomic<std::uint64_t> write_index_{ 0 };
+    alignas(detail::cache_line_size) std::atomic<std::uint64_t> read_index_{ 0 };
+    alignas(detail::cache_line_size) std::atomic<std::uint64_t> overruns_{ 0 };
+    // recorded by the consumer, kept off the producer's `overruns_` line
+    alignas(detail::cache_line_size) latency_histogram latency_;
+};
+
+// Consumer-side transform into double-buffered outputs:
+// the previous result stays valid while the next one is being computed.
+template <direction direction_, typename FloatT>
+    requires std::is_floating_point_v<FloatT>
+class stream_fft {
+public:
+    using value_type = std::complex<FloatT>;
+
+    explicit stream_fft(std::size_t frame_size) : plan_{ frame_size }, buffers_{ buffer(frame_size), buffer(frame_size) } {}
+
+    // result is valid until the second next call
+    std::span<const value_type> transform(std::span<const value_type> frame) {
+        auto& back = buffers_[back_];
+        const auto started_at = std::chrono::steady_clock::now();
+        plan_.transform(frame, std::span{ back });
+        latency_.record(std::chrono::steady_clock::now() - started_at);
+
+        back_ ^= 1;
+        return back;
+    }
+
+    // transforms the next published frame straight from the ring and releases it
+    std::optional<std::span<const value_type>> process(frame_ring<FloatT>& ring) {
+        const auto frame = ring.try_acquire();
+        if (!frame.has_value()) {
+            return std::nullopt;
+        }
+        const auto out = transform(frame->samples);
+        ring.release();
+        return out;
+    }
+
+    // latest completed result
+    [[nodiscard]] std::span<const value_type> front() const { return buffers_[back_ ^ 1]; }
+    // time spent inside the transform itself
+    [[nodiscard]] const latency_histogram& latency() const { return latency_; }
+
+private:
+    using buffer = std::vector<value_type, detail::cache_aligned_allocator<value_type>>;
+
+    fft_plan<direction_, FloatT> plan_;
+    std::array<buffer, 2> buffers_;
+    std::size_t back_ = 0;
+    latency_histogram latency_;
+};
+
+} // namespace sl::calc::fourier
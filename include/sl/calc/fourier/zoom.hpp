@@ -0,0 +1,159 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "sl/calc/fourier/detail.hpp"
+#include "sl/calc/fourier/fast.hpp"
+
+#include <sl/meta/assert.hpp>
+
+namespace sl::calc::fourier {
+namespace detail {
+
+// $$ e^{\pm i 2 \pi \cdot turns} $$, turns are reduced to [0, 1) in long double before rounding to FloatT,
+// so that the quadratic phases of long chirps keep their precision
+template <direction direction_, typename FloatT>
+std::complex<FloatT> turns_polar(long double turns) {
+    const long double reduced = turns - std::floor(turns);
+    const auto rotation = polar(direction_sign_v<direction_, long double> * 2 * std::numbers::pi_v<long double> * reduced);
+    return static_cast<std::complex<FloatT>>(rotation);
+}
+
+} // namespace detail
+
+// Chirp-z transform on a line of M frequencies, `start` + m `step`, in cycles per sample:
+// $$ X_m = \sum_{n=0}^{N-1} x_n e^{-i 2 \pi n (start + m \cdot step)} $$, normalized by 1/N for `freq_to_time`.
+// With $$ n m = \frac{n^2 + m^2 - (m - n)^2}{2} $$ it becomes a convolution with a chirp (Bluestein),
+// computed by two power-of-2 transforms of size L >= N + M - 1, N itself doesn't have to be a power of 2.
+// Chirps and the spectrum of the convolution kernel are precomputed,
+// pre-chirp is fused into the bit-reversal permutation and the kernel multiply and post-chirp into the last stages.
+template <direction direction_, typename FloatT>
+    requires std::is_floating_point_v<FloatT>
+class zoom_fft_plan {
+public:
+    zoom_fft_plan(std::size_t N, std::size_t M, FloatT start, FloatT step)
+        : N_{ N }, M_{ M }, twiddles_{ detail::make_twiddles<direction::time_to_freq, FloatT>(transform_size(N, M)) } {
+        const std::size_t L = twiddles_.size() + 1;
+        const auto step_ld = static_cast<long double>(step);
+        const auto start_ld = static_cast<long double>(start);
+        const auto chirp_turns = [step_ld](std::size_t j) {
+            const auto j_ld = static_cast<long double>(j);
+            return step_ld * j_ld * j_ld / 2;
+        };
+
+        // $$ e^{-i 2 \pi (start \cdot n + step \frac{n^2}{2})} $$
+        pre_chirp_.resize(N);
+        for (std::size_t n = 0; n != N; ++n) {
+            pre_chirp_[n] = detail::turns_polar<direction_, FloatT>(start_ld * static_cast<long double>(n) + chirp_turns(n));
+        }
+
+        // $$ e^{-i 2 \pi step \frac{m^2}{2}} $$, carries the normalization of `freq_to_time`
+        const FloatT scale = direction_ == direction::freq_to_time ? FloatT{ 1 } / static_cast<FloatT>(N) : FloatT{ 1 };
+        post_chirp_.resize(M);
+        for (std::size_t m = 0; m != M; ++m) {
+            post_chirp_[m] = detail::turns_polar<direction_, FloatT>(chirp_turns(m)) * scale;
+        }
+
+        // $$ h_j = e^{i 2 \pi step \frac{j^2}{2}} $$ for -N < j < M, negative j wrap around,
+        // carries the 1/L of the inverse transform
+        std::vector<std::complex<FloatT>> kernel(L);
+        const FloatT kernel_scale = FloatT{ 1 } / static_cast<FloatT>(L);
+        for (std::size_t j = 0; j != std::max(N, M); ++j) {
+            const auto h_j = std::conj(detail::turns_polar<direction_, FloatT>(chirp_turns(j))) * kernel_scale;
+            if (j < M) {
+                kernel[j] = h_j;
+            }
+            if (j < N && j != 0) {
+                kernel[L - j] = h_j;
+            }
+        }
+        kernel_spectrum_.resize(L);
+        detail::fft_impl<direction::time_to_freq>(
+            std::span<const std::complex<FloatT>>{ kernel },
+            std::span{ kernel_spectrum_ },
+            std::span<const std::complex<FloatT>>{ twiddles_ }
+        );
+    }
+
+    [[nodiscard]] std::size_t input_size() const { return N_; }
+    [[nodiscard]] std::size_t output_size() const { return M_; }
+    // size L of the power-of-2 transforms, and of the scratch buffer they run in
+    [[nodiscard]] std::size_t scratch_size() const { return kernel_spectrum_.size(); }
+
+    // `scratch` of `scratch_size()` holds both transforms, so that repeated calls don't allocate
+    void transform(
+        std::span<const std::complex<FloatT>> in,
+        std::span<std::complex<FloatT>> out,
+        std::span<std::complex<FloatT>> scratch
+    ) const {
+        ASSERT(in.size() == N_ && out.size() == M_, "plan is made for different sizes");
+        ASSERT(scratch.size() == scratch_size(), "scratch has to be of `scratch_size()`");
+        const std::span<const std::complex<FloatT>> twiddles = twiddles_;
+        const std::span<const std::complex<FloatT>> pre_chirp = pre_chirp_;
+        const std::span<const std::complex<FloatT>> post_chirp = post_chirp_;
+        const std::span<const std::complex<FloatT>> kernel_spectrum = kernel_spectrum_;
+
+        // Y_k H_k, conjugated, so that the inverse transform reuses the forward twiddles,
+        // the last stage stores X_k and X_{k + L/2} after reading both, so it can write them back in place
+        detail::fft_permute(scratch, [in, pre_chirp](std::size_t n) {
+            return n < in.size() ? in[n] * pre_chirp[n] : std::complex<FloatT>{};
+        });
+        detail::fft_butterflies(scratch, twiddles, [scratch, kernel_spectrum](std::size_t k, const std::complex<FloatT>& x) {
+            scratch[k] = std::conj(x * kernel_spectrum[k]);
+        });
+
+        // only the first M samples of the convolution are kept
+        detail::fft_permute_in_place(scratch);
+        detail::fft_butterflies(scratch, twiddles, [out, post_chirp](std::size_t m, const std::complex<FloatT>& x) {
+            if (m < out.size()) {
+                out[m] = std::conj(x) * post_chirp[m];
+            }
+        });
+    }
+
+    void transform(std::span<const std::complex<FloatT>> in, std::span<std::complex<FloatT>> out) const {
+        std::vector<std::complex<FloatT>> scratch(scratch_size());
+        transform(in, out, std::span{ scratch });
+    }
+
+    std::vector<std::complex<FloatT>> transform(std::span<const std::complex<FloatT>> in) const {
+        std::vector<std::complex<FloatT>> out(M_);
+        transform(in, std::span{ out });
+        return out;
+    }
+
+private:
+    // validated here, since it sizes `twiddles_` before the constructor body runs
+    static std::size_t transform_size(std::size_t N, std::size_t M) {
+        ASSERT(N > 0 && M > 0, "sizes have to be positive");
+        return std::bit_ceil(N + M - 1);
+    }
+
+private:
+    std::size_t N_;
+    std::size_t M_;
+    std::vector<std::complex<FloatT>> twiddles_;
+    std::vector<std::complex<FloatT>> pre_chirp_;
+    std::vector<std::complex<FloatT>> post_chirp_;
+    std::vector<std::complex<FloatT>> kernel_spectrum_;
+};
+
+template <direction direction_, typename FloatT, std::size_t extent_>
+    requires std::is_floating_point_v<FloatT>
+std::vector<std::complex<FloatT>>
+    zoom_fft(std::span<const std::complex<FloatT>, extent_> in, std::size_t M, FloatT start, FloatT step) {
+    return zoom_fft_plan<direction_, FloatT>{ in.size(), M, start, step }.transform(in);
+}
+
+} // namespace sl::calc::fourier
@@ -0,0 +1,302 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#pragma once
+
+#include <bit>
+#include <charconv>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace sl::calc {
+namespace detail {
+
+static_assert(std::endian::native == std::endian::little, "npy data is written and mapped as-is");
+
+template <typename T>
+inline constexpr std::string_view npy_descr = {};
+template <>
+inline constexpr std::string_view npy_descr<std::int16_t> = "<i2";
+template <>
+inline constexpr std::string_view npy_descr<std::int32_t> = "<i4";
+template <>
+inline constexpr std::string_view npy_descr<float> = "<f4";
+template <>
+inline constexpr std::string_view npy_descr<double> = "<f8";
+template <>
+inline constexpr std::string_view npy_descr<std::complex<float>> = "<c8";
+template <>
+inline constexpr std::string_view npy_descr<std::complex<double>> = "<c16";
+
+template <typename T>
+concept npy_supported = !npy_descr<T>.empty();
+
+constexpr std::string_view npy_magic = "\x93NUMPY";
+// magic + version + uint16 header length
+constexpr std::size_t npy_v1_preamble_size = npy_magic.size() + 2 + 2;
+// magic + version + uint32 header length
+constexpr std::size_t npy_v2_preamble_size = npy_magic.size() + 2 + 4;
+// numpy aligns data to 64 bytes, which keeps mapped data aligned for any element type
+constexpr std::size_t npy_alignment = 64;
+
+// {'descr': '<c16', 'fortran_order': False, 'shape': (2, 64), }, padded so that data after the preamble is aligned
+inline std::string
+    npy_header(std::string_view descr, std::span<const std::size_t> shape, std::size_t preamble_size = npy_v1_preamble_size) {
+    std::string header = "{'descr': '";
+    header += descr;
+    header += "', 'fortran_order': False, 'shape': (";
+    for (const std::size_t dim : shape) {
+        header += std::to_string(dim);
+        header += ", ";
+    }
+    if (shape.size() > 1) {
+        // single element tuples keep their trailing comma
+        header.resize(header.size() - 2);
+    } else if (shape.size() == 1) {
+        header.pop_back();
+    }
+    header += "), }";
+
+    const std::size_t unpadded_size = preamble_size + header.size() + 1;
+    header.append((npy_alignment - unpadded_size % npy_alignment) % npy_alignment, ' ');
+    header += '\n';
+    return header;
+}
+
+// value of `key` in the header dictionary, up to the next top-level separator
+inline std::optional<std::string_view> npy_header_value(std::string_view header, std::string_view key) {
+    const std::size_t key_pos = header.find(key);
+    if (key_pos == std::string_view::npos) {
+        return std::nullopt;
+    }
+    std::string_view value = header.substr(key_pos + key.size());
+    const std::size_t colon_pos = value.find(':');
+    if (colon_pos == std::string_view::npos) {
+        return std::nullopt;
+    }
+    const std::size_t value_pos = value.find_first_not_of(' ', colon_pos + 1);
+    if (value_pos == std::string_view::npos) {
+        return std::nullopt;
+    }
+    value = value.substr(value_pos);
+    if (value.front() == '(') {
+        const std::size_t end_pos = value.find(')');
+        return end_pos == std::string_view::npos ? std::nullopt : std::optional{ value.substr(0, end_pos + 1) };
+    }
+    return value.substr(0, value.find_first_of(",}"));
+}
+
+inline std::optional<std::vector<std::size_t>> npy_parse_shape(std::string_view value) {
+    if (value.size() < 2 || value.front() != '(' || value.back() != ')') {
+        return std::nullopt;
+    }
+    value = value.substr(1, value.size() - 2);
+
+    std::vector<std::size_t> shape;
+    while (true) {
+        const std::size_t begin = value.find_first_not_of(" ,");
+        if (begin == std::string_view::npos) {
+            return shape;
+        }
+        value = value.substr(begin);
+        std::size_t dim = 0;
+        const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), dim);
+        if (ec != std::errc{}) {
+            return std::nullopt;
+        }
+        shape.push_back(dim);
+        value = value.substr(static_cast<std::size_t>(ptr - value.data()));
+    }
+}
+
+} // namespace detail
+
+// Writes `data` as a C-ordered NumPy array of `shape`, 1-D if shape is omitted.
+// Data follows the header as-is, aligned to 64 bytes, so `load_npy` and `np.load(..., mmap_mode='r')` map it directly.
+template <typename T, std::size_t extent_>
+    requires detail::npy_supported<T>
+[[nodiscard]] bool
+    write_npy(const std::filesystem::path& path, std::span<const T, extent_> data, std::span<const std::size_t> shape = {}) {
+    const std::size_t flat_shape[]{ data.size() };
+    if (shape.empty()) {
+        shape = flat_shape;
+    }
+    std::size_t shape_size = 1;
+    for (const std::size_t dim : shape) {
+        shape_size *= dim;
+    }
+    if (shape_size != data.size()) {
+        return false;
+    }
+
+    // version 1.0 stores the header length in 2 bytes, longer headers (thousands of dimensions) need version 2.0 and 4
+    std::string header = detail::npy_header(detail::npy_descr<T>, shape);
+    const bool v2 = header.size() > std::numeric_limits<std::uint16_t>::max();
+    if (v2) {
+        header = detail::npy_header(detail::npy_descr<T>, shape, detail::npy_v2_preamble_size);
+        if (header.size() > std::numeric_limits<std::uint32_t>::max()) {
+            return false;
+        }
+    }
+    const std::size_t length_bytes = v2 ? 4 : 2;
+    std::string preamble{
+        static_cast<char>(v2 ? 2 : 1), // major version
+        '\x00', // minor version
+    };
+    for (std::size_t i = 0; i != length_bytes; ++i) {
+        preamble += static_cast<char>((header.size() >> (8 * i)) & 0xFF);
+    }
+
+    std::ofstream file{ path, std::ios::binary | std::ios::trunc };
+    file.write(detail::npy_magic.data(), static_cast<std::streamsize>(detail::npy_magic.size()));
+    file.write(preamble.data(), static_cast<std::streamsize>(preamble.size()));
+    file.write(header.data(), static_cast<std::streamsize>(header.size()));
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size_bytes()));
+    return file.good();
+}
+
+// Read-only memory mapping of a NumPy array, data is accessed in-place without copying.
+template <typename T>
+    requires detail::npy_supported<T>
+class npy_mapping {
+public:
+    npy_mapping(npy_mapping&& other) noexcept
+        : mapped_{ std::exchange(other.mapped_, nullptr) }, mapped_size_{ std::exchange(other.mapped_size_, 0) },
+          data_{ std::exchange(other.data_, {}) }, shape_{ std::move(other.shape_) } {}
+
+    npy_mapping& operator=(npy_mapping&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            mapped_ = std::exchange(other.mapped_, nullptr);
+            mapped_size_ = std::exchange(other.mapped_size_, 0);
+            data_ = std::exchange(other.data_, {});
+            shape_ = std::move(other.shape_);
+        }
+        return *this;
+    }
+
+    npy_mapping(const npy_mapping&) = delete;
+    npy_mapping& operator=(const npy_mapping&) = delete;
+
+    ~npy_mapping() { unmap(); }
+
+    [[nodiscard]] std::span<const T> data() const { return data_; }
+    [[nodiscard]] std::span<const std::size_t> shape() const { return shape_; }
+
+    // nullopt if the file can't be mapped, is not a C-ordered array of T or is truncated
+    static std::optional<npy_mapping> load(const std::filesystem::path& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            return std::nullopt;
+        }
+        struct stat file_stat {};
+        const bool stat_ok = ::fstat(fd, &file_stat) == 0 && file_stat.st_size > 0;
+        const auto mapped_size = stat_ok ? static_cast<std::size_t>(file_stat.st_size) : 0;
+        void* const mapped = stat_ok ? ::mmap(nullptr, mapped_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+        // mapping stays valid after the descriptor is closed
+        ::close(fd);
+        if (mapped == MAP_FAILED) {
+            return std::nullopt;
+        }
+
+        npy_mapping mapping{ static_cast<const std::byte*>(mapped), mapped_size };
+        if (!mapping.parse()) {
+            return std::nullopt;
+        }
+        return mapping;
+    }
+
+private:
+    npy_mapping(const std::byte* mapped, std::size_t mapped_size) : mapped_{ mapped }, mapped_size_{ mapped_size } {}
+
+    bool parse() {
+        const std::string_view file{ reinterpret_cast<const char*>(mapped_), mapped_size_ };
+        if (file.size() < detail::npy_v1_preamble_size || !file.starts_with(detail::npy_magic)) {
+            return false;
+        }
+
+        const auto byte_at = [file](std::size_t i) { return static_cast<std::size_t>(static_cast<unsigned char>(file[i])); };
+        const std::size_t major_version = byte_at(detail::npy_magic.size());
+        const std::size_t length_pos = detail::npy_magic.size() + 2;
+        std::size_t header_pos = 0;
+        std::size_t header_size = 0;
+        if (major_version == 1) {
+            header_pos = detail::npy_v1_preamble_size;
+            header_size = byte_at(length_pos) | byte_at(length_pos + 1) << 8;
+        } else if ((major_version == 2 || major_version == 3) && file.size() >= detail::npy_v2_preamble_size) {
+            header_pos = detail::npy_v2_preamble_size;
+            header_size = byte_at(length_pos) | byte_at(length_pos + 1) << 8 | byte_at(length_pos + 2) << 16
+                          | byte_at(length_pos + 3) << 24;
+        } else {
+            return false;
+        }
+        if (file.size() < header_pos + header_size) {
+            return false;
+        }
+        const std::string_view header = file.substr(header_pos, header_size);
+
+        const auto descr = detail::npy_header_value(header, "'descr'");
+        const auto fortran_order = detail::npy_header_value(header, "'fortran_order'");
+        const auto shape = detail::npy_header_value(header, "'shape'");
+        if (!descr || !fortran_order || !shape) {
+            return false;
+        }
+        const std::string expected_descr = "'" + std::string{ detail::npy_descr<T> } + "'";
+        if (*descr != expected_descr || *fortran_order != "False") {
+            return false;
+        }
+        auto parsed_shape = detail::npy_parse_shape(*shape);
+        if (!parsed_shape) {
+            return false;
+        }
+
+        std::size_t shape_size = 1;
+        for (const std::size_t dim : *parsed_shape) {
+            shape_size *= dim;
+        }
+        const std::size_t data_pos = header_pos + header_size;
+        if (data_pos % alignof(T) != 0 || (file.size() - data_pos) / sizeof(T) < shape_size) {
+            return false;
+        }
+
+        data_ = std::span{ reinterpret_cast<const T*>(mapped_ + data_pos), shape_size };
+        shape_ = std::move(*parsed_shape);
+        return true;
+    }
+
+    void unmap() {
+        if (mapped_ != nullptr) {
+            ::munmap(const_cast<std::byte*>(mapped_), mapped_size_);
+        }
+    }
+
+private:
+    const std::byte* mapped_ = nullptr;
+    std::size_t mapped_size_ = 0;
+    std::span<const T> data_;
+    std::vector<std::size_t> shape_;
+};
+
+template <typename T>
+    requires detail::npy_supported<T>
+std::optional<npy_mapping<T>> load_npy(const std::filesystem::path& path) {
+    return npy_mapping<T>::load(path);
+}
+
+} // namespace sl::calc
@@ -0,0 +1,75 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#include "sl/calc/fourier/analytic.hpp"
+#include "sl/calc/fourier/fast.hpp"
+
+#include "fourier_fixtures.hpp"
+
+#include <gtest/gtest.h>
+#include <utility>
+
+namespace sl::calc::fourier {
+
+constexpr std::size_t N = 1024;
+constexpr double ERR = 1e-10;
+
+// forward fft, negative bins zeroed, positive ones doubled, inverse fft
+std::vector<std::complex<double>> reference_analytic_signal(std::span<const double> in) {
+    const std::size_t size = in.size();
+    const std::vector<std::complex<double>> in_complex(in.begin(), in.end());
+    auto spectrum = fft<direction::time_to_freq>(std::span{ std::as_const(in_complex) });
+    for (std::size_t k = 1; k < size; ++k) {
+        spectrum[k] *= k < size / 2 ? 2.0 : k == size / 2 ? 1.0 : 0.0;
+    }
+    return fft<direction::freq_to_time>(std::span{ std::as_const(spectrum) });
+}
+
+TEST(analytic, matchesReference) {
+    for (const std::size_t size : { 2u, 4u, 8u, 1024u }) {
+        const auto in = produce_random_samples<double>(size);
+        const auto out = analytic_signal(std::span<const double>{ in });
+        const auto expected = reference_analytic_signal(in);
+        ASSERT_EQ(out.size(), size);
+        for (std::size_t n = 0; n < size; ++n) {
+            EXPECT_NEAR(std::abs(out[n] - expected[n]), 0.0, ERR) << "size " << size << " n " << n;
+            // real part is the signal itself
+            EXPECT_NEAR(out[n].real(), in[n], ERR);
+        }
+    }
+}
+
+TEST(analytic, hilbertOfCos) {
+    constexpr std::size_t freq = 37;
+    std::vector<double> in(N);
+    for (std::size_t n = 0; n < N; ++n) {
+        in[n] = std::cos(-detail::theta<direction::time_to_freq, double>(freq * n, N));
+    }
+    const auto out = hilbert(std::span<const double>{ in });
+    for (std::size_t n = 0; n < N; ++n) {
+        EXPECT_NEAR(out[n], std::sin(-detail::theta<direction::time_to_freq, double>(freq * n, N)), ERR);
+    }
+}
+
+TEST(analytic, envelope) {
+    constexpr std::size_t carrier_freq = 200;
+    constexpr std::size_t modulation_freq = 3;
+    std::vector<double> in(N);
+    std::vector<double> expected(N);
+    for (std::size_t n = 0; n < N; ++n) {
+        const double carrier = std::cos(-detail::theta<direction::time_to_freq, double>(carrier_freq * n, N));
+        expected[n] = 1.0 + 0.5 * std::cos(-detail::theta<direction::time_to_freq, double>(modulation_freq * n, N));
+        in[n] = expected[n] * carrier;
+    }
+
+    // caller-provided buffer
+    std::vector<double> out(N);
+    envelope(std::span<const double>{ in }, std::span{ out });
+    for (std::size_t n = 0; n < N; ++n) {
+        EXPECT_NEAR(out[n], expected[n], ERR);
+    }
+    EXPECT_EQ(out, envelope(std::span<const double>{ in }));
+}
+
+} // namespace sl::calc::fourier
@@ -69,6 +69,15 @@ TEST(Bits, partialBitswap) {
     static_assert(bitswap<uint8_t>(0b10000000, std::bit_width(0b10000000u)) == uint8_t{ 0b00000001 });
 }
 
+TEST(Bits, zeroWidthBitswap) {
+    // nothing to swap, wider types would otherwise shift by their full width
+    static_assert(bitswap<uint16_t>(0xA5C3u, 0) == uint16_t{ 0xA5C3u });
+    static_assert(bitswap<uint32_t>(0xA5C3F00Fu, 0) == 0xA5C3F00Fu);
+    static_assert(bitswap<uint64_t>(0xA5C3F00F12345678u, 0) == 0xA5C3F00F12345678u);
+    static_assert(bitswap<std::size_t>(1, 0) == 1);
+    static_assert(bitswap<std::size_t>(0, 0) == 0);
+}
+
 // Tests covering stdlib <bit> functionality, purely for documenting purposes.
 TEST(Bits, isPowerOf2) {
     static_assert(!std::has_single_bit(0u));
@@ -0,0 +1,99 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#include "sl/calc/fourier/discrete.hpp"
+#include "sl/calc/fourier/fast.hpp"
+
+#include "fourier_fixtures.hpp"
+
+#include <gtest/gtest.h>
+#include <random>
+
+namespace sl::calc::fourier {
+
+constexpr std::size_t N = 4096;
+constexpr double ERR = 1e-12;
+
+template <typename FloatT>
+std::vector<std::complex<FloatT>> cast_samples(std::span<const std::complex<double>> in) {
+    std::vector<std::complex<FloatT>> out(in.size());
+    for (std::size_t k = 0; k < in.size(); ++k) {
+        out[k] = static_cast<std::complex<FloatT>>(in[k]);
+    }
+    return out;
+}
+
+std::vector<std::complex<double>> produce_float_exact_samples() {
+    std::default_random_engine re(std::random_device{}());
+    std::uniform_real_distribution<double> uniform_dist(0.0, 2 * std::numbers::pi);
+    // exactly representable in float, so that only the transform contributes to the error
+    return produce_wave_samples<double>(
+        [&uniform_dist, &re](double) {
+            return static_cast<std::complex<double>>(static_cast<std::complex<float>>(std::polar(1.0, uniform_dist(re))));
+        },
+        N
+    );
+}
+
+TEST(fftPlan, twiddles) {
+    const fft_plan<direction::time_to_freq, double> plan{ N };
+    ASSERT_EQ(plan.twiddles().size(), N - 1);
+    for (std::size_t stride = 2; stride <= N; stride <<= 1) {
+        const auto stage = detail::stage_twiddles(plan.twiddles(), stride);
+        ASSERT_EQ(stage.size(), stride / 2);
+        for (std::size_t k = 0; k < stride / 2; ++k) {
+            const auto expected = detail::polar(detail::theta<direction::time_to_freq, long double>(k, stride));
+            EXPECT_NEAR(stage[k].real(), static_cast<double>(expected.real()), 1e-14);
+            EXPECT_NEAR(stage[k].imag(), static_cast<double>(expected.imag()), 1e-14);
+        }
+    }
+}
+
+TEST(fftPlan, reuse) {
+    const auto in = produce_float_exact_samples();
+    const fft_plan<direction::time_to_freq, double> plan{ N };
+    const auto first_out = plan.transform(in);
+    const auto second_out = plan.transform(in);
+    const auto out = fft<direction::time_to_freq>(std::span{ in });
+    EXPECT_EQ(first_out, out);
+    EXPECT_EQ(second_out, out);
+
+    const fft_plan<direction::freq_to_time, double> inverse_plan{ N };
+    const auto inverse_out = inverse_plan.transform(out);
+    for (std::size_t k = 0; k < N; ++k) {
+        EXPECT_NEAR(std::abs(inverse_out[k] - in[k]), 0.0, ERR);
+    }
+}
+
+TEST(fftPlan, inPlace) {
+    const auto in = produce_float_exact_samples();
+    const fft_plan<direction::time_to_freq, double> plan{ N };
+    const auto expected = plan.transform(in);
+    auto data = in;
+    plan.transform(data, data);
+    for (std::size_t k = 0; k < N; ++k) {
+        EXPECT_NEAR(std::abs(data[k] - expected[k]), 0.0, ERR);
+    }
+}
+
+TEST(fftPlan, singlePrecision) {
+    const auto in = produce_float_exact_samples();
+    const auto expected = dft<direction::time_to_freq>(std::span{ in });
+
+    const auto in_float = cast_samples<float>(in);
+    const auto out = fft<direction::time_to_freq>(std::span{ in_float });
+    const auto mixed_out = fft_plan<direction::time_to_freq, float, double>{ N }.transform(in_float);
+    const auto double_out = fft<direction::time_to_freq>(std::span{ in });
+
+    const double error = relative_rms_error<float>(out, expected);
+    const double mixed_error = relative_rms_error<float>(mixed_out, expected);
+    const double double_error = relative_rms_error<double>(double_out, expected);
+    // rounding error of a float transform grows as $$ \epsilon \sqrt{\log_2 N} $$ on average
+    EXPECT_LT(error, 1e-6);
+    // data is still rounded to float between stages, but twiddles and butterflies are not
+    EXPECT_LT(mixed_error, error);
+    EXPECT_LT(double_error, 1e-12);
+}
+
+} // namespace sl::calc::fourier
@@ -85,4 +85,58 @@ TEST(fft, random) {
     write_test_data("fft_random", std::span{ in }, std::span{ normalized_out });
 }
 
+TEST(fft, inverse) {
+    std::default_random_engine re(std::random_device{}());
+    std::uniform_real_distribution<double> uniform_dist(0.0, 2 * std::numbers::pi);
+    const auto in =
+        produce_wave_samples<double>([&uniform_dist, &re](double) { return std::polar(1.0, uniform_dist(re)); }, N);
+    const auto out = fft<direction::time_to_freq>(std::span{ in });
+    const auto inverse_out = fft<direction::freq_to_time>(std::span{ out });
+    const auto dft_inverse_out = dft<direction::freq_to_time>(std::span{ out });
+    for (std::size_t k = 0; k < N; ++k) {
+        EXPECT_NEAR(inverse_out[k].real(), in[k].real(), ERR);
+        EXPECT_NEAR(inverse_out[k].imag(), in[k].imag(), ERR);
+        EXPECT_NEAR(inverse_out[k].real(), dft_inverse_out[k].real(), ERR);
+        EXPECT_NEAR(inverse_out[k].imag(), dft_inverse_out[k].imag(), ERR);
+    }
+}
+
+TEST(fft, inPlace) {
+    std::default_random_engine re(std::random_device{}());
+    std::uniform_real_distribution<double> uniform_dist(0.0, 2 * std::numbers::pi);
+    auto data =
+        produce_wave_samples<double>([&uniform_dist, &re](double) { return std::polar(1.0, uniform_dist(re)); }, N);
+    const auto in = data;
+    const auto expected = fft<direction::time_to_freq>(std::span{ in });
+    fft<direction::time_to_freq>(std::span<const std::complex<double>>{ data }, std::span{ data });
+    for (std::size_t k = 0; k < N; ++k) {
+        EXPECT_NEAR(std::abs(data[k] - expected[k]), 0.0, ERR);
+    }
+    fft<direction::freq_to_time>(std::span<const std::complex<double>>{ data }, std::span{ data });
+    for (std::size_t k = 0; k < N; ++k) {
+        EXPECT_NEAR(std::abs(data[k] - in[k]), 0.0, ERR);
+    }
+}
+
+// N = 1 has no butterflies, N = 2 is only the last stage
+TEST(fft, smallSizes) {
+    std::default_random_engine re(std::random_device{}());
+    std::uniform_real_distribution<double> uniform_dist(0.0, 2 * std::numbers::pi);
+    for (const std::size_t size : { 1u, 2u }) {
+        const auto in = produce_wave_samples<double>(
+            [&uniform_dist, &re](double) { return std::polar(1.0, uniform_dist(re)); }, size
+        );
+        const auto out = fft<direction::time_to_freq>(std::span{ in });
+        const auto inverse_out = fft<direction::freq_to_time>(std::span{ in });
+        const auto dft_out = dft<direction::time_to_freq>(std::span{ in });
+        const auto dft_inverse_out = dft<direction::freq_to_time>(std::span{ in });
+        ASSERT_EQ(out.size(), size);
+        ASSERT_EQ(inverse_out.size(), size);
+        for (std::size_t k = 0; k < size; ++k) {
+            EXPECT_NEAR(std::abs(out[k] - dft_out[k]), 0.0, ERR) << "size " << size << " k " << k;
+            EXPECT_NEAR(std::abs(inverse_out[k] - dft_inverse_out[k]), 0.0, ERR) << "size " << size << " k " << k;
+        }
+    }
+}
+
 } // namespace sl::calc::fourier
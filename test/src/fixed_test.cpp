@@ -0,0 +1,120 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#include "sl/calc/fourier/fast.hpp"
+#include "sl/calc/fourier/fixed.hpp"
+
+#include "fourier_fixtures.hpp"
+
+#include <gtest/gtest.h>
+#include <random>
+
+namespace sl::calc::fourier {
+
+constexpr std::size_t N = 1024;
+
+template <typename IntT>
+std::vector<q_complex<IntT>> produce_random_q_samples(std::default_random_engine& re, IntT amplitude) {
+    std::uniform_int_distribution<IntT> sample_dist(static_cast<IntT>(-amplitude), amplitude);
+    std::vector<q_complex<IntT>> samples(N);
+    for (auto& x : samples) {
+        x = { sample_dist(re), sample_dist(re) };
+    }
+    return samples;
+}
+
+template <typename IntT>
+std::vector<std::complex<double>> to_complex(const std::vector<q_complex<IntT>>& samples) {
+    return rescale<double>(fixed_fft_result<IntT>{ { samples.begin(), samples.end() }, 0 });
+}
+
+template <direction direction_, typename IntT>
+double fixed_fft_error(const std::vector<q_complex<IntT>>& in) {
+    const auto out = fixed_fft<direction_>(std::span{ in });
+    const auto in_complex = to_complex(in);
+    const auto expected = fft<direction_>(std::span{ in_complex });
+    return relative_rms_error<double>(rescale<double>(out), expected);
+}
+
+TEST(fixedFft, int16) {
+    std::default_random_engine re(std::random_device{}());
+    const auto in = produce_random_q_samples<std::int16_t>(re, std::numeric_limits<std::int16_t>::max());
+    // block floating point loses about half a bit per stage to rounding
+    EXPECT_LT((fixed_fft_error<direction::time_to_freq, std::int16_t>(in)), 1e-3);
+    EXPECT_LT((fixed_fft_error<direction::freq_to_time, std::int16_t>(in)), 1e-3);
+}
+
+TEST(fixedFft, int32) {
+    std::default_random_engine re(std::random_device{}());
+    const auto in = produce_random_q_samples<std::int32_t>(re, std::numeric_limits<std::int32_t>::max());
+    EXPECT_LT((fixed_fft_error<direction::time_to_freq, std::int32_t>(in)), 1e-7);
+    EXPECT_LT((fixed_fft_error<direction::freq_to_time, std::int32_t>(in)), 1e-7);
+}
+
+TEST(fixedFft, fullScale) {
+    // the most negative sample can't be negated in place, stages have to scale it down first
+    const std::vector<q_complex<std::int16_t>> in(N, { std::numeric_limits<std::int16_t>::min(), 0 });
+    const auto out = fixed_fft<direction::time_to_freq>(std::span{ in });
+    const auto rescaled = rescale<double>(out);
+    EXPECT_NEAR(std::abs(rescaled[0] - std::complex<double>(-static_cast<double>(N), 0.0)), 0.0, 1e-9);
+    for (std::size_t k = 1; k < N; ++k) {
+        EXPECT_EQ(out.values[k], (q_complex<std::int16_t>{ 0, 0 }));
+    }
+}
+
+TEST(fixedFft, exponent) {
+    std::default_random_engine re(std::random_device{}());
+    const auto quiet = produce_random_q_samples<std::int16_t>(re, 64);
+    const auto loud = produce_random_q_samples<std::int16_t>(re, std::numeric_limits<std::int16_t>::max());
+    const auto quiet_out = fixed_fft<direction::time_to_freq>(std::span{ quiet });
+    const auto loud_out = fixed_fft<direction::time_to_freq>(std::span{ loud });
+    // small samples have headroom to grow before any scaling kicks in
+    EXPECT_LT(quiet_out.exponent, loud_out.exponent);
+    EXPECT_LE(loud_out.exponent, static_cast<int>(2 * std::countr_zero(N)));
+    EXPECT_LT((fixed_fft_error<direction::time_to_freq, std::int16_t>(quiet)), 1e-2);
+
+    const auto inverse_out = fixed_fft<direction::freq_to_time>(std::span{ loud });
+    EXPECT_EQ(inverse_out.exponent, loud_out.exponent - std::countr_zero(N));
+}
+
+TEST(fixedFft, planReuse) {
+    std::default_random_engine re(std::random_device{}());
+    const auto in = produce_random_q_samples<std::int16_t>(re, std::numeric_limits<std::int16_t>::max());
+    const fixed_fft_plan<direction::time_to_freq, std::int16_t> plan{ N };
+    std::vector<q_complex<std::int16_t>> out(N);
+    const int exponent = plan.transform(in, out);
+    const auto expected = fixed_fft<direction::time_to_freq>(std::span{ in });
+    EXPECT_EQ(exponent, expected.exponent);
+    EXPECT_EQ(out, expected.values);
+}
+
+#if defined(SL_CALC_FIXED_FFT_SSSE3)
+TEST(fixedFft, ssse3MatchesScalar) {
+    if (!detail::cpu_supports_ssse3()) {
+        GTEST_SKIP() << "SSSE3 is not supported by this CPU";
+    }
+    std::default_random_engine re(std::random_device{}());
+    const auto twiddles = detail::make_fixed_twiddles<direction::time_to_freq, std::int16_t>(N);
+    for (std::size_t stride = 8; stride <= N; stride <<= 1) {
+        for (int shift = 0; shift <= 3; ++shift) {
+            // shifts assume the data fits, see `q_extent::stage_shift`
+            const auto amplitude = static_cast<std::int16_t>(
+                std::min<std::int32_t>((std::int32_t{ 1 } << (13 + shift)) - 1, std::numeric_limits<std::int16_t>::max())
+            );
+            auto scalar = produce_random_q_samples<std::int16_t>(re, amplitude);
+            auto simd = scalar;
+            detail::q_extent<std::int16_t> scalar_extent;
+            detail::q_extent<std::int16_t> simd_extent;
+            const auto stage_twiddles = std::span{ twiddles }.subspan(stride / 2 - 1, stride / 2);
+            detail::fixed_stage<std::int16_t>(scalar, stage_twiddles, stride, shift, scalar_extent);
+            detail::fixed_stage_ssse3(simd, stage_twiddles, stride, shift, simd_extent);
+            EXPECT_EQ(scalar, simd) << "stride " << stride << " shift " << shift;
+            EXPECT_EQ(scalar_extent.min, simd_extent.min);
+            EXPECT_EQ(scalar_extent.max, simd_extent.max);
+        }
+    }
+}
+#endif
+
+} // namespace sl::calc::fourier
@@ -4,24 +4,18 @@
 
 #pragma once
 
+#include <cmath>
 #include <complex>
-#include <fstream>
 #include <numbers>
+#include <random>
 #include <type_traits>
 #include <vector>
 #include <span>
 
 #include "sl/calc/fourier/detail.hpp"
+#include "sl/calc/npy.hpp"
 #include <fmt/format.h>
-#include <fmt/ranges.h>
-
-template <typename T, typename Char>
-struct fmt::formatter<std::complex<T>, Char> : public fmt::formatter<T, Char> {
-    template <typename FormatCtx>
-    auto format(const std::complex<T>& x, FormatCtx& ctx) const -> decltype(ctx.out()) {
-        return fmt::format_to(ctx.out(), "[{}, {}]", x.real(), x.imag());
-    }
-};
+#include <gtest/gtest.h>
 
 namespace sl::calc::fourier {
 
@@ -40,14 +34,43 @@ std::vector<std::complex<FloatT>> produce_wave_samples(sample_producer f, std::s
     return wave_samples;
 }
 
+// uniform in [-1, 1), both parts for complex samples
+template <typename SampleT>
+std::vector<SampleT> produce_random_samples(std::size_t N) {
+    std::default_random_engine re(std::random_device{}());
+    std::uniform_real_distribution<double> uniform_dist(-1.0, 1.0);
+    std::vector<SampleT> samples(N);
+    for (auto& x : samples) {
+        if constexpr (std::is_floating_point_v<SampleT>) {
+            x = uniform_dist(re);
+        } else {
+            x = { uniform_dist(re), uniform_dist(re) };
+        }
+    }
+    return samples;
+}
+
+// writes "{name}_in.npy" and "{name}_out.npy", see test/notebooks/fourier_visualize.ipynb
 template <typename FloatT, std::size_t extent_in_, std::size_t extent_out_>
 void write_test_data(
     std::string_view name,
     std::span<const std::complex<FloatT>, extent_in_> in,
     std::span<const std::complex<FloatT>, extent_out_> out
 ) {
-    std::ofstream{ fmt::format("{}.json", name) }
-        << fmt::format(R"({{ "in": [{}], "out": [{}] }})", fmt::join(in, ", "), fmt::join(out, ", "));
+    EXPECT_TRUE(write_npy(fmt::format("{}_in.npy", name), in));
+    EXPECT_TRUE(write_npy(fmt::format("{}_out.npy", name), out));
+}
+
+// $$ \sqrt{\frac{\sum |x_k - y_k|^2}{\sum |y_k|^2}} $$
+template <typename FloatT>
+double relative_rms_error(std::span<const std::complex<FloatT>> x, std::span<const std::complex<double>> y) {
+    double error = 0.0;
+    double energy = 0.0;
+    for (std::size_t k = 0; k < y.size(); ++k) {
+        error += std::norm(static_cast<std::complex<double>>(x[k]) - y[k]);
+        energy += std::norm(y[k]);
+    }
+    return std::sqrt(error / energy);
 }
 
 template <typename FloatT>
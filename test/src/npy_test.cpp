@@ -0,0 +1,96 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#include "sl/calc/npy.hpp"
+
+#include "fourier_fixtures.hpp"
+
+#include <gtest/gtest.h>
+
+namespace sl::calc {
+
+constexpr std::size_t N = 64;
+
+TEST(npy, header) {
+    const std::size_t flat_shape[]{ N };
+    const std::string flat_header = detail::npy_header("<c16", flat_shape);
+    EXPECT_TRUE(flat_header.starts_with("{'descr': '<c16', 'fortran_order': False, 'shape': (64,), }"));
+    EXPECT_TRUE(flat_header.ends_with(" \n"));
+    EXPECT_EQ((detail::npy_v1_preamble_size + flat_header.size()) % detail::npy_alignment, 0);
+
+    const std::size_t matrix_shape[]{ 2, N };
+    const std::string matrix_header = detail::npy_header("<f4", matrix_shape);
+    EXPECT_TRUE(matrix_header.starts_with("{'descr': '<f4', 'fortran_order': False, 'shape': (2, 64), }"));
+    EXPECT_EQ((detail::npy_v1_preamble_size + matrix_header.size()) % detail::npy_alignment, 0);
+}
+
+TEST(npy, complexRoundTrip) {
+    const auto in = fourier::produce_wave_samples<double>([](double theta) { return std::polar(1.0, theta); }, N);
+    ASSERT_TRUE(write_npy("npy_complex.npy", std::span{ in }));
+
+    const auto mapping = load_npy<std::complex<double>>("npy_complex.npy");
+    ASSERT_TRUE(mapping.has_value());
+    ASSERT_EQ(mapping->shape().size(), 1);
+    EXPECT_EQ(mapping->shape()[0], N);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapping->data().data()) % detail::npy_alignment, 0);
+    EXPECT_TRUE(std::equal(in.begin(), in.end(), mapping->data().begin(), mapping->data().end()));
+
+    // element type has to match exactly
+    EXPECT_FALSE(load_npy<std::complex<float>>("npy_complex.npy").has_value());
+    EXPECT_FALSE(load_npy<double>("npy_complex.npy").has_value());
+}
+
+TEST(npy, matrixRoundTrip) {
+    std::vector<float> in(3 * N);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        in[i] = static_cast<float>(i) * 0.5f;
+    }
+    const std::size_t shape[]{ 3, N };
+    ASSERT_TRUE(write_npy("npy_matrix.npy", std::span<const float>{ in }, shape));
+
+    auto mapping = load_npy<float>("npy_matrix.npy");
+    ASSERT_TRUE(mapping.has_value());
+    ASSERT_EQ(mapping->shape().size(), 2);
+    EXPECT_EQ(mapping->shape()[0], 3);
+    EXPECT_EQ(mapping->shape()[1], N);
+
+    // mapping is move-only, data stays mapped while moved around
+    const npy_mapping<float> moved = std::move(*mapping);
+    EXPECT_TRUE(std::equal(in.begin(), in.end(), moved.data().begin(), moved.data().end()));
+
+    const std::size_t wrong_shape[]{ 2, N };
+    EXPECT_FALSE(write_npy("npy_matrix_wrong.npy", std::span<const float>{ in }, wrong_shape));
+}
+
+TEST(npy, longHeader) {
+    // "1, " per dimension doesn't fit the uint16 header length of version 1.0
+    const std::vector<std::size_t> shape(30'000, 1);
+    const std::vector<float> in{ 42.0f };
+    ASSERT_TRUE(write_npy("npy_long_header.npy", std::span{ in }, shape));
+
+    char preamble[detail::npy_v2_preamble_size]{};
+    std::ifstream{ "npy_long_header.npy", std::ios::binary }.read(preamble, sizeof(preamble));
+    EXPECT_EQ(preamble[detail::npy_magic.size()], '\x02');
+
+    const auto mapping = load_npy<float>("npy_long_header.npy");
+    ASSERT_TRUE(mapping.has_value());
+    EXPECT_TRUE(std::equal(shape.begin(), shape.end(), mapping->shape().begin(), mapping->shape().end()));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapping->data().data()) % detail::npy_alignment, 0);
+    ASSERT_EQ(mapping->data().size(), 1);
+    EXPECT_EQ(mapping->data()[0], 42.0f);
+}
+
+TEST(npy, malformed) {
+    EXPECT_FALSE(load_npy<double>("npy_does_not_exist.npy").has_value());
+
+    std::ofstream{ "npy_not_numpy.npy" } << "{ \"in\": [], \"out\": [] }";
+    EXPECT_FALSE(load_npy<double>("npy_not_numpy.npy").has_value());
+
+    const std::vector<double> in(N, 1.0);
+    ASSERT_TRUE(write_npy("npy_truncated.npy", std::span{ in }));
+    std::filesystem::resize_file("npy_truncated.npy", std::filesystem::file_size("npy_truncated.npy") - sizeof(double));
+    EXPECT_FALSE(load_npy<double>("npy_truncated.npy").has_value());
+}
+
+} // namespace sl::calc
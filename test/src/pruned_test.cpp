@@ -0,0 +1,73 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#include "sl/calc/fourier/fast.hpp"
+#include "sl/calc/fourier/pruned.hpp"
+
+#include "fourier_fixtures.hpp"
+
+#include <gtest/gtest.h>
+#include <utility>
+
+namespace sl::calc::fourier {
+
+constexpr std::size_t N = 1024;
+constexpr double ERR = 1e-10;
+
+template <direction direction_>
+void expect_input_pruned(std::size_t L) {
+    const auto in = produce_random_samples<std::complex<double>>(L);
+    std::vector<std::complex<double>> padded(N);
+    std::copy(in.begin(), in.end(), padded.begin());
+
+    const auto out = fft_input_pruned<direction_>(std::span{ std::as_const(in) }, N);
+    const auto expected = fft<direction_>(std::span{ std::as_const(padded) });
+    ASSERT_EQ(out.size(), N);
+    for (std::size_t k = 0; k < N; ++k) {
+        EXPECT_NEAR(std::abs(out[k] - expected[k]), 0.0, ERR) << "L " << L << " k " << k;
+    }
+}
+
+template <direction direction_>
+void expect_output_pruned(std::size_t M) {
+    const auto in = produce_random_samples<std::complex<double>>(N);
+
+    const auto out = fft_output_pruned<direction_>(std::span{ std::as_const(in) }, M);
+    const auto expected = fft<direction_>(std::span{ std::as_const(in) });
+    ASSERT_EQ(out.size(), M);
+    for (std::size_t k = 0; k < M; ++k) {
+        EXPECT_NEAR(std::abs(out[k] - expected[k]), 0.0, ERR) << "M " << M << " k " << k;
+    }
+}
+
+TEST(prunedFft, inputPruned) {
+    for (const std::size_t L : { 1u, 2u, 16u, 100u, 512u, 1024u }) {
+        expect_input_pruned<direction::time_to_freq>(L);
+        expect_input_pruned<direction::freq_to_time>(L);
+    }
+}
+
+TEST(prunedFft, outputPruned) {
+    for (const std::size_t M : { 1u, 2u, 16u, 100u, 512u, 1024u }) {
+        expect_output_pruned<direction::time_to_freq>(M);
+        expect_output_pruned<direction::freq_to_time>(M);
+    }
+}
+
+TEST(prunedFft, planReuse) {
+    const pruned_fft_plan<direction::time_to_freq, double> plan{ N };
+    ASSERT_EQ(plan.size(), N);
+    const auto in = produce_random_samples<std::complex<double>>(N);
+    const auto expected = fft<direction::time_to_freq>(std::span{ std::as_const(in) });
+
+    std::vector<std::complex<double>> out(N / 4);
+    for (std::size_t i = 0; i < 2; ++i) {
+        plan.transform_output_pruned(in, out);
+        for (std::size_t k = 0; k < out.size(); ++k) {
+            EXPECT_NEAR(std::abs(out[k] - expected[k]), 0.0, ERR);
+        }
+    }
+}
+
+} // namespace sl::calc::fourier
@@ -0,0 +1,42 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#include "sl/calc/fourier/fast.hpp"
+#include "sl/calc/fourier/real.hpp"
+
+#include "fourier_fixtures.hpp"
+
+#include <gtest/gtest.h>
+
+namespace sl::calc::fourier {
+
+constexpr double ERR = 1e-10;
+
+TEST(rfft, matchesComplexFft) {
+    for (const std::size_t N : { 2u, 4u, 8u, 1024u }) {
+        const auto in = produce_random_samples<double>(N);
+        const std::vector<std::complex<double>> in_complex(in.begin(), in.end());
+
+        const auto out = rfft(std::span<const double>{ in });
+        const auto expected = fft<direction::time_to_freq>(std::span{ in_complex });
+        ASSERT_EQ(out.size(), N / 2 + 1);
+        for (std::size_t k = 0; k < out.size(); ++k) {
+            EXPECT_NEAR(std::abs(out[k] - expected[k]), 0.0, ERR) << "N " << N << " k " << k;
+        }
+    }
+}
+
+TEST(rfft, planReuse) {
+    constexpr std::size_t N = 256;
+    const real_fft_plan<double> plan{ N };
+    ASSERT_EQ(plan.bin_count(), N / 2 + 1);
+    for (std::size_t i = 0; i < 2; ++i) {
+        const auto in = produce_random_samples<double>(N);
+        std::vector<std::complex<double>> out(plan.bin_count());
+        plan.transform(in, out);
+        EXPECT_EQ(out, rfft(std::span<const double>{ in }));
+    }
+}
+
+} // namespace sl::calc::fourier
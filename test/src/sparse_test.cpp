@@ -0,0 +1,159 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#include "sl/calc/fourier/fast.hpp"
+#include "sl/calc/fourier/sparse.hpp"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <bit>
+#include <random>
+
+namespace sl::calc::fourier {
+
+constexpr std::size_t N = 1 << 14;
+constexpr double ERR = 1e-6;
+
+struct tone {
+    std::size_t freq;
+    std::complex<double> amplitude;
+};
+
+// frequencies are apart modulo `buckets`, so that hashing into that many buckets isolates every tone
+std::vector<tone> produce_tones(std::default_random_engine& re, std::size_t k, std::size_t buckets) {
+    std::uniform_int_distribution<std::size_t> freq_dist(0, N - 1);
+    std::uniform_real_distribution<double> magnitude_dist(1.0, 10.0);
+    std::uniform_real_distribution<double> phase_dist(0.0, 2 * std::numbers::pi);
+    std::vector<tone> tones;
+    while (tones.size() != k) {
+        const std::size_t freq = freq_dist(re);
+        if (std::none_of(tones.begin(), tones.end(), [freq, buckets](const tone& t) {
+                return t.freq % buckets == freq % buckets;
+            })) {
+            tones.push_back({ freq, std::polar(magnitude_dist(re), phase_dist(re)) });
+        }
+    }
+    return tones;
+}
+
+// $$ x_n = \sum_j a_j e^{i 2 \pi \frac{f_j n}{N}} $$, so that X_{f_j} = N a_j
+std::vector<std::complex<double>> produce_signal(std::span<const tone> tones) {
+    std::vector<std::complex<double>> signal(N);
+    for (const auto& [freq, amplitude] : tones) {
+        for (std::size_t n = 0; n < N; ++n) {
+            signal[n] += amplitude * detail::polar(detail::theta<direction::freq_to_time, double>(freq * n, N));
+        }
+    }
+    return signal;
+}
+
+void expect_tones(std::span<const sparse_coefficient<double>> out, std::span<const tone> tones, double scale, double err) {
+    ASSERT_EQ(out.size(), tones.size());
+    for (const auto& [freq, amplitude] : tones) {
+        const auto it = std::find_if(out.begin(), out.end(), [freq](const auto& c) { return c.index == freq; });
+        ASSERT_NE(it, out.end()) << "missing frequency " << freq;
+        EXPECT_NEAR(std::abs(it->value - scale * amplitude), 0.0, err);
+    }
+}
+
+// buckets of the first round, tones apart in them are all located in it and verified in the next one,
+// which N = 2^14 affords up to k = 64, tones congruent modulo every affordable B would fall back
+std::size_t first_round_buckets(std::size_t k) { return std::bit_ceil(2 * k); }
+
+TEST(sparseFft, exactlySparse) {
+    std::default_random_engine re(std::random_device{}());
+    for (const std::size_t k : { 1u, 4u, 16u, 64u }) {
+        const auto tones = produce_tones(re, k, first_round_buckets(k));
+        const auto in = produce_signal(tones);
+        const auto out = sparse_fft<direction::time_to_freq>(std::span<const std::complex<double>>{ in }, k);
+        EXPECT_FALSE(out.dense_fallback) << "k = " << k;
+        expect_tones(out.coefficients, tones, static_cast<double>(N), ERR * static_cast<double>(N));
+    }
+}
+
+TEST(sparseFft, collidingTones) {
+    std::default_random_engine re(std::random_device{}());
+    std::uniform_int_distribution<std::size_t> freq_dist(0, N - 1);
+    std::uniform_real_distribution<double> phase_dist(0.0, 2 * std::numbers::pi);
+    // 8 apart share a bucket in the first rounds, B = 4 and 8, and only separate once B = 16
+    const std::size_t freq = freq_dist(re);
+    const std::vector<tone> tones{
+        { freq, std::polar(3.0, phase_dist(re)) },
+        { (freq + 8) % N, std::polar(5.0, phase_dist(re)) },
+    };
+    const auto in = produce_signal(tones);
+    const auto out = sparse_fft<direction::time_to_freq>(std::span<const std::complex<double>>{ in }, tones.size());
+    EXPECT_FALSE(out.dense_fallback);
+    expect_tones(out.coefficients, tones, static_cast<double>(N), ERR * static_cast<double>(N));
+}
+
+TEST(sparseFft, harmonicSeriesFallsBack) {
+    std::default_random_engine re(std::random_device{}());
+    std::uniform_real_distribution<double> phase_dist(0.0, 2 * std::numbers::pi);
+    // the 64 multiples of 256 fall into max(1, B/256) buckets, some of them share one for every B < N,
+    // so hashing never isolates them
+    std::vector<tone> tones;
+    for (std::size_t freq = 0; freq < N; freq += 256) {
+        tones.push_back({ freq, std::polar(1.0 + static_cast<double>(freq / 256), phase_dist(re)) });
+    }
+    const auto in = produce_signal(tones);
+    const auto out = sparse_fft<direction::time_to_freq>(std::span<const std::complex<double>>{ in }, tones.size());
+    EXPECT_TRUE(out.dense_fallback);
+    expect_tones(out.coefficients, tones, static_cast<double>(N), ERR * static_cast<double>(N));
+}
+
+TEST(sparseFft, inverse) {
+    std::default_random_engine re(std::random_device{}());
+    const auto tones = produce_tones(re, 8, first_round_buckets(8));
+    const auto in = produce_signal(tones);
+    const auto out = sparse_fft<direction::freq_to_time>(std::span<const std::complex<double>>{ in }, tones.size());
+    EXPECT_FALSE(out.dense_fallback);
+    // freq_to_time sees e^{+i ...} tones at -f, normalized by N
+    std::vector<tone> mirrored_tones;
+    for (const auto& [freq, amplitude] : tones) {
+        mirrored_tones.push_back({ (N - freq) % N, amplitude });
+    }
+    expect_tones(out.coefficients, mirrored_tones, 1.0, ERR);
+}
+
+TEST(sparseFft, noisy) {
+    std::default_random_engine re(std::random_device{}());
+    std::normal_distribution<double> noise_dist(0.0, 0.05);
+    const auto tones = produce_tones(re, 8, first_round_buckets(8));
+    auto in = produce_signal(tones);
+    for (auto& x : in) {
+        x += std::complex{ noise_dist(re), noise_dist(re) };
+    }
+    const auto out = sparse_fft<direction::time_to_freq>(
+        std::span<const std::complex<double>>{ in }, tones.size(), { .tolerance = 2e-4 }
+    );
+    EXPECT_FALSE(out.dense_fallback);
+    expect_tones(out.coefficients, tones, static_cast<double>(N), 0.05 * static_cast<double>(N));
+}
+
+TEST(sparseFft, denseFallback) {
+    std::default_random_engine re(std::random_device{}());
+    std::uniform_real_distribution<double> uniform_dist(0.0, 2 * std::numbers::pi);
+    std::vector<std::complex<double>> in(N);
+    for (auto& x : in) {
+        x = std::polar(1.0, uniform_dist(re));
+    }
+    constexpr std::size_t k = 4;
+    const auto out = sparse_fft<direction::time_to_freq>(std::span<const std::complex<double>>{ in }, k);
+    const auto dense_out = fft<direction::time_to_freq>(std::span<const std::complex<double>>{ in });
+
+    std::vector<double> magnitudes;
+    for (const auto& x : dense_out) {
+        magnitudes.push_back(std::abs(x));
+    }
+    std::sort(magnitudes.begin(), magnitudes.end(), std::greater<>{});
+    EXPECT_TRUE(out.dense_fallback);
+    ASSERT_EQ(out.coefficients.size(), k);
+    for (std::size_t i = 0; i < k; ++i) {
+        EXPECT_NEAR(std::abs(out.coefficients[i].value), magnitudes[i], ERR);
+        EXPECT_EQ(out.coefficients[i].value, dense_out[out.coefficients[i].index]);
+    }
+}
+
+} // namespace sl::calc::fourier
@@ -0,0 +1,120 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#include "sl/calc/fourier/discrete.hpp"
+#include "sl/calc/fourier/spectral.hpp"
+
+#include "fourier_fixtures.hpp"
+
+#include <gtest/gtest.h>
+#include <random>
+
+namespace sl::calc::fourier {
+
+constexpr std::size_t N = 64;
+constexpr double ERR = 1e-12;
+
+// reference: window, transform, magnitude-squared and average as separate passes
+std::vector<double> welch_reference(std::span<const std::complex<double>> in, std::span<const double> w, std::size_t hop) {
+    const std::size_t segment_size = w.size();
+    double window_power = 0.0;
+    for (const double w_n : w) {
+        window_power += w_n * w_n;
+    }
+
+    std::vector<double> psd(segment_size);
+    std::size_t segments = 0;
+    for (std::size_t offset = 0; offset + segment_size <= in.size(); offset += hop, ++segments) {
+        std::vector<std::complex<double>> segment(segment_size);
+        for (std::size_t n = 0; n < segment_size; ++n) {
+            segment[n] = in[offset + n] * w[n];
+        }
+        const auto out = dft<direction::time_to_freq>(std::span<const std::complex<double>>{ segment });
+        for (std::size_t k = 0; k < segment_size; ++k) {
+            psd[k] += std::norm(out[k]) / window_power;
+        }
+    }
+    for (auto& x : psd) {
+        x /= static_cast<double>(segments);
+    }
+    return psd;
+}
+
+TEST(spectral, windows) {
+    const spectral_plan<double> hann{ window::hann, N, N };
+    const spectral_plan<double> hamming{ window::hamming, N, N };
+    const spectral_plan<double> blackman_harris{ window::blackman_harris, N, N };
+
+    EXPECT_NEAR(hann.coefficients()[0], 0.0, ERR);
+    EXPECT_NEAR(hann.coefficients()[N / 2], 1.0, ERR);
+    EXPECT_NEAR(hamming.coefficients()[0], 0.08, ERR);
+    EXPECT_NEAR(hamming.coefficients()[N / 2], 1.0, ERR);
+    EXPECT_NEAR(blackman_harris.coefficients()[0], 6e-5, ERR);
+    EXPECT_NEAR(blackman_harris.coefficients()[N / 2], 1.0, ERR);
+    for (std::size_t n = 1; n < N; ++n) {
+        EXPECT_NEAR(hann.coefficients()[n], hann.coefficients()[N - n], ERR);
+    }
+}
+
+TEST(spectral, segmentCount) {
+    const spectral_plan<double> plan{ window::hann, N, N / 2 };
+    EXPECT_EQ(plan.segment_count(N - 1), 0);
+    EXPECT_EQ(plan.segment_count(N), 1);
+    EXPECT_EQ(plan.segment_count(N + N / 2 - 1), 1);
+    EXPECT_EQ(plan.segment_count(N + N / 2), 2);
+    EXPECT_EQ(plan.segment_count(4 * N), 7);
+}
+
+TEST(spectral, welchHarmonicSum) {
+    const auto in = produce_wave_samples<double>(
+        [](double theta) { return std::complex{ std::sin(5 * theta) + std::cos(12 * theta), 0.0 }; }, 8 * N
+    );
+    const spectral_plan<double> plan{ window::hann, N, N / 2 };
+    const auto psd = plan.welch(std::span{ in });
+    const auto expected = welch_reference(in, plan.coefficients(), plan.hop());
+    ASSERT_EQ(psd.size(), N);
+    for (std::size_t k = 0; k < N; ++k) {
+        EXPECT_NEAR(psd[k], expected[k], ERR);
+    }
+}
+
+TEST(spectral, welchRandom) {
+    std::default_random_engine re(std::random_device{}());
+    std::uniform_real_distribution<double> uniform_dist(0.0, 2 * std::numbers::pi);
+    const auto in = produce_wave_samples<double>(
+        [&uniform_dist, &re](double) { return std::polar(1.0, uniform_dist(re)); }, 5 * N + 3
+    );
+    for (const window kind : { window::hann, window::hamming, window::blackman_harris }) {
+        const spectral_plan<double> plan{ kind, N, N / 4 };
+        const auto psd = plan.welch(std::span{ in });
+        const auto expected = welch_reference(in, plan.coefficients(), plan.hop());
+        for (std::size_t k = 0; k < N; ++k) {
+            EXPECT_NEAR(psd[k], expected[k], ERR);
+        }
+    }
+}
+
+TEST(spectral, spectrogram) {
+    const auto in = produce_wave_samples<double>([](double theta) { return std::polar(1.0, 16 * theta); }, 4 * N);
+    const spectral_plan<double> plan{ window::blackman_harris, N, N };
+    const auto rows = plan.spectrogram(std::span{ in });
+    ASSERT_EQ(rows.size(), 4 * N);
+    for (std::size_t segment = 0; segment < 4; ++segment) {
+        const auto expected = welch_reference(
+            std::span{ in }.subspan(segment * N, N), plan.coefficients(), plan.hop()
+        );
+        for (std::size_t k = 0; k < N; ++k) {
+            EXPECT_NEAR(rows[segment * N + k], expected[k], ERR);
+        }
+    }
+}
+
+TEST(spectral, welchShortcut) {
+    const auto in = produce_wave_samples<double>([](double theta) { return std::complex{ std::cos(theta), 0.0 }; }, 2 * N);
+    const auto psd = welch<window::hamming>(std::span{ in }, N, N / 2);
+    const auto expected = spectral_plan<double>{ window::hamming, N, N / 2 }.welch(std::span{ in });
+    EXPECT_EQ(psd, expected);
+}
+
+} // namespace sl::calc::fourier
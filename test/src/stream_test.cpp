@@ -0,0 +1,175 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#include "sl/calc/fourier/fast.hpp"
+#include "sl/calc/fourier/stream.hpp"
+
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace sl::calc::fourier {
+
+constexpr std::size_t N = 64;
+constexpr double ERR = 1e-12;
+constexpr std::size_t CHUNK = 24;
+
+std::vector<std::complex<double>> produce_stream(std::size_t first_sample, std::size_t size) {
+    std::vector<std::complex<double>> samples(size);
+    for (std::size_t n = 0; n < size; ++n) {
+        samples[n] = { static_cast<double>(first_sample + n), -static_cast<double>(first_sample + n) };
+    }
+    return samples;
+}
+
+TEST(stream, frames) {
+    frame_ring<double> ring{ N, 4 };
+    EXPECT_FALSE(ring.try_acquire().has_value());
+
+    const auto samples = produce_stream(0, 2 * N + N / 2);
+    // uneven chunks, frames are published only when complete
+    EXPECT_EQ(ring.push(std::span{ samples }.first(N / 2)), N / 2);
+    EXPECT_FALSE(ring.try_acquire().has_value());
+    EXPECT_EQ(ring.push(std::span{ samples }.subspan(N / 2)), 2 * N);
+    EXPECT_EQ(ring.published(), 2);
+
+    for (std::size_t i = 0; i < 2; ++i) {
+        const auto frame = ring.try_acquire();
+        ASSERT_TRUE(frame.has_value());
+        EXPECT_EQ(frame->first_sample, i * N);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(frame->samples.data()) % detail::cache_line_size, 0);
+        EXPECT_TRUE(std::equal(frame->samples.begin(), frame->samples.end(), std::span{ samples }.subspan(i * N).begin()));
+        ring.release();
+    }
+    EXPECT_FALSE(ring.try_acquire().has_value());
+    EXPECT_EQ(ring.consumed(), 2);
+    EXPECT_EQ(ring.latency().total(), 2);
+    EXPECT_EQ(ring.overruns(), 0);
+}
+
+TEST(stream, latencyBuckets) {
+    latency_histogram histogram;
+    histogram.record(latency_histogram::duration{ 0 });
+    histogram.record(latency_histogram::duration{ 5 });
+    histogram.record(latency_histogram::duration::max());
+    EXPECT_EQ(histogram.count(0), 1);
+    EXPECT_EQ(histogram.count(3), 1);
+    EXPECT_EQ(histogram.count(latency_histogram::bucket_count - 1), 1);
+    EXPECT_EQ(histogram.total(), 3);
+
+    EXPECT_EQ(latency_histogram::upper_bound(0), latency_histogram::duration{ 1 });
+    EXPECT_EQ(latency_histogram::upper_bound(3), latency_histogram::duration{ 8 });
+    EXPECT_EQ(
+        latency_histogram::upper_bound(latency_histogram::bucket_count - 2),
+        latency_histogram::duration{ std::int64_t{ 1 } << (latency_histogram::bucket_count - 2) }
+    );
+    EXPECT_EQ(latency_histogram::upper_bound(latency_histogram::bucket_count - 1), latency_histogram::duration::max());
+}
+
+TEST(stream, overrun) {
+    frame_ring<double> ring{ N, 2 };
+    const auto samples = produce_stream(0, 4 * N);
+    EXPECT_EQ(ring.push(std::span{ samples }.first(3 * N)), 2 * N);
+    EXPECT_EQ(ring.overruns(), 1);
+
+    ASSERT_TRUE(ring.try_acquire().has_value());
+    ring.release();
+    // third frame was dropped entirely, the fourth one takes the freed slot
+    EXPECT_EQ(ring.push(std::span{ samples }.subspan(3 * N)), N);
+    EXPECT_EQ(ring.overruns(), 1);
+
+    for (const std::size_t first_sample : { N, 3 * N }) {
+        const auto frame = ring.try_acquire();
+        ASSERT_TRUE(frame.has_value());
+        EXPECT_EQ(frame->first_sample, first_sample);
+        EXPECT_EQ(frame->samples.front(), samples[first_sample]);
+        ring.release();
+    }
+}
+
+TEST(stream, doubleBuffered) {
+    stream_fft<direction::time_to_freq, double> transformer{ N };
+    const auto first_in = produce_stream(0, N);
+    const auto second_in = produce_stream(N, N);
+
+    const auto first_out = transformer.transform(std::span{ first_in });
+    const auto second_out = transformer.transform(std::span{ second_in });
+    EXPECT_NE(first_out.data(), second_out.data());
+    EXPECT_EQ(transformer.front().data(), second_out.data());
+    EXPECT_EQ(transformer.latency().total(), 2);
+
+    const auto first_expected = fft<direction::time_to_freq>(std::span{ first_in });
+    const auto second_expected = fft<direction::time_to_freq>(std::span{ second_in });
+    for (std::size_t k = 0; k < N; ++k) {
+        EXPECT_NEAR(std::abs(first_out[k] - first_expected[k]), 0.0, ERR);
+        EXPECT_NEAR(std::abs(second_out[k] - second_expected[k]), 0.0, ERR);
+    }
+}
+
+TEST(stream, process) {
+    frame_ring<double> ring{ N, 4 };
+    stream_fft<direction::time_to_freq, double> transformer{ N };
+    EXPECT_FALSE(transformer.process(ring).has_value());
+
+    const auto samples = produce_stream(0, 2 * N);
+    ASSERT_EQ(ring.push(std::span{ samples }), 2 * N);
+    for (std::size_t i = 0; i < 2; ++i) {
+        const auto out = transformer.process(ring);
+        ASSERT_TRUE(out.has_value());
+        EXPECT_EQ(out->data(), transformer.front().data());
+        EXPECT_EQ(ring.consumed(), i + 1);
+
+        const auto expected = fft<direction::time_to_freq>(std::span{ samples }.subspan(i * N, N));
+        ASSERT_EQ(out->size(), N);
+        for (std::size_t k = 0; k < N; ++k) {
+            EXPECT_NEAR(std::abs((*out)[k] - expected[k]), 0.0, ERR);
+        }
+    }
+    EXPECT_FALSE(transformer.process(ring).has_value());
+    EXPECT_EQ(ring.latency().total(), 2);
+    EXPECT_EQ(transformer.latency().total(), 2);
+}
+
+TEST(stream, producerConsumer) {
+    constexpr std::size_t frames = 1024;
+    frame_ring<double> ring{ N, 8 };
+    const auto samples = produce_stream(0, frames * N);
+
+    std::thread producer{ [&ring, &samples] {
+        for (std::size_t offset = 0; offset < samples.size(); offset += CHUNK) {
+            ring.push(std::span{ samples }.subspan(offset, std::min(CHUNK, samples.size() - offset)));
+        }
+    } };
+
+    stream_fft<direction::time_to_freq, double> transformer{ N };
+    std::size_t consumed = 0;
+    std::uint64_t last_first_sample = 0;
+    while (consumed + ring.overruns() < frames) {
+        const auto frame = ring.try_acquire();
+        if (!frame.has_value()) {
+            continue;
+        }
+        // EXPECT only, returning from the loop would leave `producer` joinable
+        EXPECT_EQ(frame->first_sample % N, 0);
+        EXPECT_TRUE(consumed == 0 || frame->first_sample > last_first_sample);
+        EXPECT_TRUE(
+            frame->first_sample + N <= samples.size()
+            && std::equal(
+                frame->samples.begin(), frame->samples.end(), std::span{ samples }.subspan(frame->first_sample).begin()
+            )
+        );
+        last_first_sample = frame->first_sample;
+
+        const auto out = transformer.transform(frame->samples);
+        ring.release();
+        EXPECT_NEAR(out[0].real(), static_cast<double>(N * last_first_sample + N * (N - 1) / 2), ERR);
+        ++consumed;
+    }
+    producer.join();
+
+    EXPECT_EQ(ring.consumed(), consumed);
+    EXPECT_EQ(ring.published() + ring.overruns(), frames);
+    EXPECT_EQ(ring.latency().total(), consumed);
+}
+
+} // namespace sl::calc::fourier
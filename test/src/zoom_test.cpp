@@ -0,0 +1,96 @@
+//
+// Created by usatiynyan on 10/19/26.
+//
+
+#include "sl/calc/fourier/discrete.hpp"
+#include "sl/calc/fourier/fast.hpp"
+#include "sl/calc/fourier/zoom.hpp"
+
+#include "fourier_fixtures.hpp"
+
+#include <gtest/gtest.h>
+#include <bit>
+
+namespace sl::calc::fourier {
+
+constexpr double ERR = 1e-9;
+
+// $$ X(f) = \sum_n x_n e^{-i 2 \pi f n} $$, accumulated in long double
+template <direction direction_>
+std::complex<double> dtft(std::span<const std::complex<double>> in, long double f) {
+    std::complex<long double> out{};
+    for (std::size_t n = 0; n != in.size(); ++n) {
+        const long double turns = f * static_cast<long double>(n);
+        const auto rotation = detail::polar(
+            detail::direction_sign_v<direction_, long double> * 2 * std::numbers::pi_v<long double> * (turns - std::floor(turns))
+        );
+        out += static_cast<std::complex<long double>>(in[n]) * rotation;
+    }
+    return static_cast<std::complex<double>>(out);
+}
+
+TEST(zoomFft, fullCircleIsDft) {
+    // not a power of 2
+    constexpr std::size_t N = 100;
+    const auto in = produce_random_samples<std::complex<double>>(N);
+    const auto step = 1.0 / static_cast<double>(N);
+
+    const auto out = zoom_fft<direction::time_to_freq>(std::span{ in }, N, 0.0, step);
+    const auto expected = dft<direction::time_to_freq>(std::span{ in });
+    for (std::size_t k = 0; k < N; ++k) {
+        EXPECT_NEAR(std::abs(out[k] - expected[k]), 0.0, ERR);
+    }
+
+    const auto inverse_out = zoom_fft<direction::freq_to_time>(std::span{ in }, N, 0.0, step);
+    const auto inverse_expected = dft<direction::freq_to_time>(std::span{ in });
+    for (std::size_t k = 0; k < N; ++k) {
+        EXPECT_NEAR(std::abs(inverse_out[k] - inverse_expected[k]), 0.0, ERR);
+    }
+}
+
+TEST(zoomFft, narrowBand) {
+    constexpr std::size_t N = 4096;
+    constexpr std::size_t M = 257;
+    // 1/64 of a bin apart, zero-padding would take N * 64 samples
+    constexpr double step = 1.0 / (64.0 * N);
+    constexpr double tone = 0.1234567;
+    const double start = tone - step * (M / 2);
+
+    const auto in = produce_wave_samples<double>([](double theta) { return std::polar(1.0, theta * tone * N); }, N);
+
+    const auto out = zoom_fft<direction::time_to_freq>(std::span{ in }, M, start, step);
+    for (std::size_t m = 0; m < M; ++m) {
+        const auto f = static_cast<long double>(start) + static_cast<long double>(m) * step;
+        EXPECT_NEAR(std::abs(out[m] - dtft<direction::time_to_freq>(in, f)), 0.0, 1e-8 * N);
+    }
+
+    const auto peak = std::max_element(out.begin(), out.end(), [](const auto& a, const auto& b) {
+        return std::norm(a) < std::norm(b);
+    });
+    const double peak_freq = start + step * static_cast<double>(peak - out.begin());
+    EXPECT_NEAR(peak_freq, tone, step / 2);
+    EXPECT_NEAR(std::abs(*peak), static_cast<double>(N), 1e-2 * N);
+}
+
+TEST(zoomFft, planReuse) {
+    constexpr std::size_t N = 300;
+    constexpr std::size_t M = 50;
+    const zoom_fft_plan<direction::time_to_freq, double> plan{ N, M, 0.2, 1e-4 };
+    ASSERT_EQ(plan.input_size(), N);
+    ASSERT_EQ(plan.output_size(), M);
+    ASSERT_EQ(plan.scratch_size(), std::bit_ceil(N + M - 1));
+    std::vector<std::complex<double>> scratch(plan.scratch_size());
+    std::vector<std::complex<double>> scratch_out(M);
+    for (std::size_t i = 0; i < 3; ++i) {
+        const auto in = produce_random_samples<std::complex<double>>(N);
+        const auto out = plan.transform(in);
+        EXPECT_EQ(out, (zoom_fft<direction::time_to_freq>(std::span{ in }, M, 0.2, 1e-4)));
+        plan.transform(in, std::span{ scratch_out }, std::span{ scratch });
+        EXPECT_EQ(scratch_out, out);
+        for (std::size_t m = 0; m < M; ++m) {
+            EXPECT_NEAR(std::abs(out[m] - dtft<direction::time_to_freq>(in, 0.2L + m * 1e-4L)), 0.0, ERR);
+        }
+    }
+}
+
+} // namespace sl::calc::fourier